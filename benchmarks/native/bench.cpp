@@ -0,0 +1,299 @@
+// Native benchmark harness for the C++ core.
+//
+// A minimal hand-rolled harness: each benchmark is warmed up, then run in
+// growing batches until it has accumulated enough wall time for a stable
+// ns/op figure. Progress goes to stderr; the final report is JSON on stdout
+// so runs can be saved and diffed between releases.
+
+#include "algorithms/base_algorithm.hpp"
+#include "core/algorithm_factory.hpp"
+#include "engine/similarity_engine.hpp"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <ctime>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace TextSimilarity;
+
+// Results must not be optimized away
+volatile double g_sink = 0.0;
+
+struct BenchmarkResult {
+  std::string name;
+  uint64_t iterations;
+  double ns_per_op;
+};
+
+std::vector<BenchmarkResult> g_results;
+std::string g_filter;
+
+template <typename Fn> void run_benchmark(const std::string &name, Fn &&fn) {
+  if (!g_filter.empty() && name.find(g_filter) == std::string::npos) {
+    return;
+  }
+
+  using clock = std::chrono::steady_clock;
+
+  for (int i = 0; i < 3; ++i) {
+    fn();
+  }
+
+  constexpr double min_time_ns = 2e8; // 200ms per benchmark
+  constexpr uint64_t max_iterations = 10'000'000;
+
+  uint64_t iterations = 0;
+  uint64_t batch = 1;
+  double elapsed_ns = 0.0;
+
+  while (elapsed_ns < min_time_ns && iterations < max_iterations) {
+    const auto start = clock::now();
+    for (uint64_t i = 0; i < batch; ++i) {
+      fn();
+    }
+    elapsed_ns += static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() -
+                                                             start)
+            .count());
+    iterations += batch;
+    batch = std::min<uint64_t>(batch * 2, 65536);
+  }
+
+  const double ns_per_op = elapsed_ns / static_cast<double>(iterations);
+  std::fprintf(stderr, "%-56s %14.1f ns/op  (%" PRIu64 " iters)\n",
+               name.c_str(), ns_per_op, iterations);
+  g_results.push_back(BenchmarkResult{name, iterations, ns_per_op});
+}
+
+// Deterministic inputs so runs are comparable between releases
+
+std::string make_ascii(size_t length, uint32_t seed) {
+  std::mt19937 rng(seed);
+  static const char alphabet[] =
+      "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ 0123456789";
+  std::string result;
+  result.reserve(length);
+  for (size_t i = 0; i < length; ++i) {
+    result += alphabet[rng() % (sizeof(alphabet) - 1)];
+  }
+  return result;
+}
+
+// length counts code points, not bytes
+std::string make_multibyte(size_t length, uint32_t seed) {
+  std::mt19937 rng(seed);
+  static const char *const pool[] = {"é", "ü", "ß", "ł", "ż", "€",
+                                     "日", "本", "語", "α", "β", "я"};
+  constexpr size_t pool_size = sizeof(pool) / sizeof(pool[0]);
+  std::string result;
+  result.reserve(length * 3);
+  for (size_t i = 0; i < length; ++i) {
+    result += pool[rng() % pool_size];
+  }
+  return result;
+}
+
+struct AlgorithmPlan {
+  Core::AlgorithmType type;
+  Core::AlgorithmConfig config;
+  size_t max_ascii_length;
+  size_t max_multibyte_length;
+};
+
+std::vector<AlgorithmPlan> make_algorithm_plans() {
+  constexpr size_t quadratic_cap = 4096; // full DP, 64k would take minutes
+  constexpr size_t linear_cap = 65536;
+
+  Core::AlgorithmConfig character{};
+
+  Core::AlgorithmConfig ngram{};
+  ngram.preprocessing = Core::PreprocessingMode::NGram;
+  ngram.ngram_size = 2;
+
+  Core::AlgorithmConfig word{};
+  word.preprocessing = Core::PreprocessingMode::Word;
+
+  Core::AlgorithmConfig tversky = ngram;
+  tversky.alpha = 0.5;
+  tversky.beta = 0.5;
+
+  return {
+      // ASCII Levenshtein runs the bit-parallel Myers kernel, so it gets
+      // the full range; the generic DP paths are capped at the quadratic
+      // tier
+      {Core::AlgorithmType::Levenshtein, character, linear_cap,
+       quadratic_cap},
+      {Core::AlgorithmType::DamerauLevenshtein, character, quadratic_cap,
+       quadratic_cap},
+      {Core::AlgorithmType::Hamming, character, linear_cap, linear_cap},
+      {Core::AlgorithmType::Jaro, character, quadratic_cap, quadratic_cap},
+      {Core::AlgorithmType::JaroWinkler, character, quadratic_cap,
+       quadratic_cap},
+      {Core::AlgorithmType::Jaccard, ngram, linear_cap, linear_cap},
+      {Core::AlgorithmType::SorensenDice, ngram, linear_cap, linear_cap},
+      {Core::AlgorithmType::Overlap, ngram, linear_cap, linear_cap},
+      {Core::AlgorithmType::Tversky, tversky, linear_cap, linear_cap},
+      {Core::AlgorithmType::Cosine, word, linear_cap, linear_cap},
+      {Core::AlgorithmType::Euclidean, word, linear_cap, linear_cap},
+      {Core::AlgorithmType::Manhattan, word, linear_cap, linear_cap},
+      {Core::AlgorithmType::Chebyshev, word, linear_cap, linear_cap},
+  };
+}
+
+const size_t kLengthTiers[] = {4, 16, 64, 256, 4096, 65536};
+
+void bench_algorithms() {
+  auto factory = Core::create_algorithm_factory();
+
+  for (const auto &plan : make_algorithm_plans()) {
+    auto algorithm = factory->create_algorithm(plan.type, plan.config);
+    const std::string algorithm_name = Core::get_algorithm_name(plan.type);
+
+    for (size_t length : kLengthTiers) {
+      for (bool multibyte : {false, true}) {
+        const size_t cap =
+            multibyte ? plan.max_multibyte_length : plan.max_ascii_length;
+        if (length > cap) {
+          continue;
+        }
+
+        // Distinct seeds so the quick-answer shortcut never fires and the
+        // real kernel runs; lengths stay equal for Hamming
+        Core::UnicodeString s1{multibyte ? make_multibyte(length, 1)
+                                         : make_ascii(length, 1)};
+        Core::UnicodeString s2{multibyte ? make_multibyte(length, 2)
+                                         : make_ascii(length, 2)};
+
+        run_benchmark("algorithm/" + algorithm_name + "/" +
+                          (multibyte ? "multibyte" : "ascii") + "/" +
+                          std::to_string(length),
+                      [&algorithm, s1, s2]() {
+                        auto result = algorithm->calculate_similarity(s1, s2);
+                        g_sink = result.is_success() ? result.value() : -1.0;
+                      });
+      }
+    }
+  }
+}
+
+void bench_unicode_and_tokenizer() {
+  Core::AlgorithmConfig word{};
+  word.preprocessing = Core::PreprocessingMode::Word;
+
+  Core::AlgorithmConfig ngram{};
+  ngram.preprocessing = Core::PreprocessingMode::NGram;
+  ngram.ngram_size = 2;
+
+  for (size_t length : kLengthTiers) {
+    for (bool multibyte : {false, true}) {
+      const char *variant = multibyte ? "multibyte" : "ascii";
+      const std::string utf8 =
+          multibyte ? make_multibyte(length, 3) : make_ascii(length, 3);
+
+      run_benchmark("unicode/UnicodeString/" + std::string(variant) + "/" +
+                        std::to_string(length),
+                    [&utf8]() {
+                      Core::UnicodeString converted{utf8};
+                      g_sink = static_cast<double>(converted.length());
+                    });
+
+      Core::UnicodeString text{utf8};
+      run_benchmark("tokenizer/word/" + std::string(variant) + "/" +
+                        std::to_string(length),
+                    [&text, &word]() {
+                      auto tokens =
+                          Algorithms::BaseAlgorithm::tokenize_string(text,
+                                                                     word);
+                      g_sink = static_cast<double>(tokens.size());
+                    });
+      run_benchmark("tokenizer/ngram2/" + std::string(variant) + "/" +
+                        std::to_string(length),
+                    [&text, &ngram]() {
+                      auto tokens =
+                          Algorithms::BaseAlgorithm::tokenize_string(text,
+                                                                     ngram);
+                      g_sink = static_cast<double>(tokens.size());
+                    });
+    }
+  }
+}
+
+void bench_engine_paths() {
+  auto engine = Engine::create_similarity_engine();
+
+  const std::string query = make_ascii(64, 10);
+  std::vector<std::string> candidate_storage;
+  candidate_storage.reserve(256);
+  for (uint32_t i = 0; i < 256; ++i) {
+    candidate_storage.push_back(make_ascii(64, 100 + i));
+  }
+  std::vector<std::string_view> candidates(candidate_storage.begin(),
+                                           candidate_storage.end());
+
+  run_benchmark("engine/one_to_many/256x64", [&]() {
+    auto results = engine->calculate_one_to_many(
+        query, candidates, Core::AlgorithmType::Levenshtein);
+    g_sink = static_cast<double>(results.size());
+  });
+
+  std::vector<std::pair<std::string, std::string>> pairs;
+  pairs.reserve(256);
+  for (uint32_t i = 0; i < 256; ++i) {
+    pairs.emplace_back(make_ascii(64, 300 + i), make_ascii(64, 600 + i));
+  }
+
+  run_benchmark("engine/batch/256x64", [&]() {
+    auto results = engine->calculate_similarity_batch(
+        pairs, Core::AlgorithmType::Levenshtein);
+    g_sink = static_cast<double>(results.size());
+  });
+
+  // Identical inputs every call: after the first iteration this measures
+  // the result cache hit path
+  run_benchmark("engine/cache_hit/64", [&]() {
+    auto result = engine->calculate_similarity(
+        query, candidate_storage[0], Core::AlgorithmType::Levenshtein);
+    g_sink = result.is_success() ? result.value() : -1.0;
+  });
+}
+
+void print_json_report() {
+  char timestamp[32];
+  const std::time_t now = std::time(nullptr);
+  std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ",
+                std::gmtime(&now));
+
+  std::printf("{\n");
+  std::printf("  \"harness\": \"text_similarity_bench\",\n");
+  std::printf("  \"timestamp\": \"%s\",\n", timestamp);
+  std::printf("  \"benchmarks\": [\n");
+  for (size_t i = 0; i < g_results.size(); ++i) {
+    const auto &result = g_results[i];
+    std::printf("    { \"name\": \"%s\", \"iterations\": %" PRIu64
+                ", \"ns_per_op\": %.2f, \"ops_per_sec\": %.1f }%s\n",
+                result.name.c_str(), result.iterations, result.ns_per_op,
+                1e9 / result.ns_per_op, (i + 1 < g_results.size()) ? "," : "");
+  }
+  std::printf("  ]\n");
+  std::printf("}\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc > 1) {
+    g_filter = argv[1];
+  }
+
+  bench_algorithms();
+  bench_unicode_and_tokenizer();
+  bench_engine_paths();
+
+  print_json_report();
+  return 0;
+}
@@ -11,6 +11,7 @@
 const { Command } = require("commander");
 const path = require("node:path");
 const fs = require("node:fs");
+const readline = require("node:readline");
 
 const lib = require(path.resolve(__dirname, "..", "index.js"));
 
@@ -319,6 +320,207 @@ program
     }
   });
 
+// ─── stream command ───────────────────────────────────────────────────
+
+/**
+ * Write one line to stdout, waiting for the drain event when the kernel
+ * buffer is full so a slow consumer applies backpressure to the pipeline.
+ */
+function writeLineWithBackpressure(line) {
+  return new Promise((resolve) => {
+    if (process.stdout.write(`${line}\n`)) {
+      resolve();
+    } else {
+      process.stdout.once("drain", resolve);
+    }
+  });
+}
+
+/**
+ * Map string enum names in a --config JSON object onto the addon's numeric
+ * enum values, so '{"caseSensitivity":"insensitive"}' works the same as the
+ * numeric form. Unknown names abort with an error instead of being silently
+ * ignored by the addon.
+ */
+function normalizeStreamConfig(config) {
+  if (typeof config.preprocessing === "string") {
+    const mode = resolvePreprocessing(config.preprocessing.toLowerCase());
+    if (mode === undefined) {
+      console.error(
+        `Error: Unknown preprocessing mode "${config.preprocessing}".`,
+      );
+      process.exit(1);
+    }
+    config.preprocessing = mode;
+  }
+
+  if (typeof config.caseSensitivity === "string") {
+    const map = {
+      sensitive: lib.CaseSensitivity.SENSITIVE,
+      insensitive: lib.CaseSensitivity.INSENSITIVE,
+    };
+    const mode = map[config.caseSensitivity.toLowerCase()];
+    if (mode === undefined) {
+      console.error(
+        `Error: Unknown case sensitivity "${config.caseSensitivity}".`,
+      );
+      process.exit(1);
+    }
+    config.caseSensitivity = mode;
+  }
+
+  return config;
+}
+
+/**
+ * Parse one NDJSON input record into a [string1, string2] pair.
+ * Accepts ["a","b"] or {"s1":"a","s2":"b"} (optionally with an "id"
+ * passed through to the output record).
+ */
+function parseStreamRecord(line) {
+  const parsed = JSON.parse(line);
+
+  if (Array.isArray(parsed)) {
+    if (parsed.length !== 2) {
+      throw new Error("Array records must contain exactly two strings");
+    }
+    return { pair: parsed, id: undefined };
+  }
+
+  if (
+    parsed !== null &&
+    typeof parsed === "object" &&
+    typeof parsed.s1 === "string" &&
+    typeof parsed.s2 === "string"
+  ) {
+    return { pair: [parsed.s1, parsed.s2], id: parsed.id };
+  }
+
+  throw new Error('Records must be ["a","b"] or {"s1":"a","s2":"b"}');
+}
+
+program
+  .command("stream")
+  .description(
+    "Read NDJSON pair records from stdin and stream NDJSON results to stdout.\n" +
+      "One warm engine process handles millions of records: input is chunked\n" +
+      "through the native async batch path instead of paying process startup\n" +
+      "per comparison.",
+  )
+  .option(
+    "-a, --algorithm <name>",
+    `algorithm to use (${ALGORITHM_CHOICES.join(", ")})`,
+    "levenshtein",
+  )
+  .option(
+    "--config <json>",
+    "algorithm configuration as a JSON object (see AlgorithmConfig)",
+  )
+  .option(
+    "-c, --concurrency <count>",
+    "worker threads per batch (0 = all available cores)",
+    "0",
+  )
+  .option(
+    "--chunk-size <count>",
+    "records accumulated per native batch call",
+    "1024",
+  )
+  .action(async (opts) => {
+    const algorithmType = resolveAlgorithm(opts.algorithm);
+    if (algorithmType === undefined) {
+      console.error(`Error: Unknown algorithm "${opts.algorithm}".`);
+      console.error(`Available algorithms: ${ALGORITHM_CHOICES.join(", ")}`);
+      process.exit(1);
+    }
+
+    let config = {};
+    if (opts.config) {
+      try {
+        config = JSON.parse(opts.config);
+      } catch (err) {
+        console.error(`Error: --config is not valid JSON: ${err.message}`);
+        process.exit(1);
+      }
+      config = normalizeStreamConfig(config);
+    }
+    config.concurrency = Number(opts.concurrency);
+    // Typed-array results avoid one result object per record on big chunks
+    config.resultFormat = "typed-array";
+
+    const chunkSize = Math.max(1, Number(opts.chunkSize) || 1024);
+
+    let pending = [];
+    let nextIndex = 0;
+
+    /**
+     * Score the accumulated chunk through the native async batch path and
+     * emit one NDJSON result line per record.
+     */
+    async function flushChunk() {
+      if (pending.length === 0) {
+        return;
+      }
+      const chunk = pending;
+      pending = [];
+
+      const results = await lib.calculateSimilarityBatchAsync(
+        chunk.map((record) => record.pair),
+        algorithmType,
+        config,
+      );
+      const failures = new Map(
+        results.errors.map((failure) => [failure.index, failure.message]),
+      );
+
+      for (let i = 0; i < chunk.length; i++) {
+        const output = { index: chunk[i].index };
+        if (chunk[i].id !== undefined) {
+          output.id = chunk[i].id;
+        }
+        const failure = failures.get(i);
+        if (failure !== undefined) {
+          output.error = failure;
+        } else {
+          output.value = results.scores[i];
+        }
+        await writeLineWithBackpressure(JSON.stringify(output));
+      }
+    }
+
+    const input = readline.createInterface({
+      input: process.stdin,
+      crlfDelay: Infinity,
+    });
+
+    // for-await pauses stdin while a chunk is in flight, so input,
+    // scoring and output stay in lockstep with the slowest side
+    for await (const line of input) {
+      const trimmed = line.trim();
+      if (trimmed === "") {
+        continue;
+      }
+
+      const index = nextIndex++;
+      let record;
+      try {
+        record = parseStreamRecord(trimmed);
+      } catch (err) {
+        await writeLineWithBackpressure(
+          JSON.stringify({ index, error: err.message }),
+        );
+        continue;
+      }
+
+      pending.push({ pair: record.pair, id: record.id, index });
+      if (pending.length >= chunkSize) {
+        await flushChunk();
+      }
+    }
+
+    await flushChunk();
+  });
+
 // ─── algorithms command ───────────────────────────────────────────────
 
 program
@@ -24,12 +24,22 @@
         "src/core/unicode.cpp",
         "src/core/memory_pool.cpp",
         "src/core/algorithm_factory.cpp",
+        "src/core/statistics.cpp",
         "src/algorithms/base_algorithm.cpp",
         "src/algorithms/levenshtein.cpp",
         "src/algorithms/token_based.cpp",
         "src/algorithms/vector_based.cpp",
         "src/algorithms/phonetic.cpp",
-        "src/engine/similarity_engine.cpp"
+        "src/engine/cascade.cpp",
+        "src/engine/prefilter.cpp",
+        "src/engine/incremental_matcher.cpp",
+        "src/engine/prepared_cache.cpp",
+        "src/engine/result_cache.cpp",
+        "src/engine/shared_result_cache.cpp",
+        "src/engine/similarity_engine.cpp",
+        "src/index/corpus_index.cpp",
+        "src/index/inverted_index.cpp",
+        "src/lsh/minhash_index.cpp"
       ],
 
       "configurations": {
@@ -89,6 +99,7 @@
         }],
         [ "OS=='linux'", {
           "cflags_cc+": [ "-std=c++17", "-frtti", "-O3" ],
+          "libraries": [ "-lrt" ],
           "conditions": [
             [ "target_arch=='x64'", {
               "cflags_cc+": [ "-mavx2", "-msse4.2", "-march=native" ]
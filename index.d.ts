@@ -105,6 +105,57 @@ declare module "text-similarity-node" {
     /** Maximum allowed input string length in bytes (default: 100000 = ~100KB).
      * Increase this when comparing large documents. */
     maxStringLength?: number;
+
+    /** Number of worker threads used by batch operations (batch calls only;
+     * default: 0 = all available hardware threads). */
+    concurrency?: number;
+
+    /** Result cache entry capacity (global configuration only; changing it
+     * discards all cached entries; default: 10000). */
+    cacheCapacity?: number;
+
+    /** Back the result cache with a named shared-memory segment so cluster
+     * workers on the same host share one warm cache (global configuration
+     * only). Attaching never clears a segment other workers already warmed.
+     * Falls back silently to the in-process cache when shared memory is
+     * unavailable; all workers must use the same algorithm configuration. */
+    sharedCache?: boolean;
+
+    /** Name of the shared cache segment (default: '/text-similarity-cache').
+     * Workers sharing a name share the cache. */
+    sharedCacheName?: string;
+
+    /** Size of the shared cache segment in bytes (default: 16 MiB). Only
+     * the first worker to attach sizes the table; later workers adopt its
+     * geometry. */
+    sharedCacheBytes?: number;
+
+    /** MinHash signature length for buildSignatures/deduplicate
+     * (default: 128). More permutations tighten the estimate at the cost of
+     * signature size and build time. */
+    minhashPermutations?: number;
+
+    /** LSH band count for buildSignatures/deduplicate (default: 32). Must
+     * divide minhashPermutations; more bands raise recall at lower
+     * thresholds, fewer bands cut candidate counts. */
+    lshBands?: number;
+
+    /** Result shape for batch and one-to-many calls. 'typed-array' returns
+     * scores in one Float64Array (NaN at failed positions, failures listed
+     * separately) instead of one result object per element, avoiding the GC
+     * churn of large batches (default: per-element objects). */
+    resultFormat?: "typed-array";
+  }
+
+  /**
+   * Batch results in typed-array form ({ resultFormat: 'typed-array' })
+   */
+  export interface TypedArrayResults {
+    /** One score per input element; failed positions hold NaN */
+    scores: Float64Array;
+
+    /** Sparse list of failures; empty when every element succeeded */
+    errors: { index: number; message: string }[];
   }
 
   /**
@@ -150,6 +201,14 @@ declare module "text-similarity-node" {
   // MAIN LIBRARY FUNCTIONS
   // ============================================================================
 
+  /**
+   * A string argument, or its UTF-8 bytes as a Buffer/Uint8Array.
+   *
+   * Buffer inputs are read in place (zero-copy across the JS/C++ boundary),
+   * which avoids the per-call string conversion for large documents.
+   */
+  export type StringLike = string | Uint8Array;
+
   /**
    * Calculate similarity between two strings (synchronous)
    *
@@ -170,8 +229,8 @@ declare module "text-similarity-node" {
    * ```
    */
   export function calculateSimilarity(
-    s1: string,
-    s2: string,
+    s1: StringLike,
+    s2: StringLike,
     algorithm?: AlgorithmType | string,
     config?: AlgorithmConfig,
   ): SimilarityResult;
@@ -196,8 +255,8 @@ declare module "text-similarity-node" {
    * ```
    */
   export function calculateDistance(
-    s1: string,
-    s2: string,
+    s1: StringLike,
+    s2: StringLike,
     algorithm?: AlgorithmType | string,
     config?: AlgorithmConfig,
   ): DistanceResult;
@@ -207,8 +266,10 @@ declare module "text-similarity-node" {
    *
    * @param pairs Array of string pairs to compare
    * @param algorithm Algorithm to use (default: Levenshtein)
-   * @param config Additional configuration options
-   * @returns Array of similarity results
+   * @param config Additional configuration options (supports concurrency
+   *               and resultFormat)
+   * @returns Array of similarity results, or {@link TypedArrayResults}
+   *          when `resultFormat: 'typed-array'` is set
    *
    * @example
    * ```typescript
@@ -226,14 +287,683 @@ declare module "text-similarity-node" {
    *     console.log(`Pair ${index}: ${result.value}`);
    *   }
    * });
+   *
+   * // Large batches: one Float64Array instead of a million result objects
+   * const { scores, errors } = calculateSimilarityBatch(pairs, 'levenshtein', {
+   *   resultFormat: 'typed-array',
+   * });
    * ```
    */
   export function calculateSimilarityBatch(
     pairs: [string, string][],
     algorithm?: AlgorithmType | string,
     config?: AlgorithmConfig,
+  ): SimilarityResult[] | TypedArrayResults;
+
+  /**
+   * Calculate similarity of one query string against many candidates
+   *
+   * The query is converted and preprocessed exactly once, so this is
+   * significantly faster than a batch call repeating the same left-hand
+   * string for large candidate sets.
+   *
+   * @param query Query string to compare
+   * @param candidates Array of candidate strings
+   * @param algorithm Algorithm to use (default: Levenshtein)
+   * @param config Additional configuration options (supports resultFormat)
+   * @returns Array of similarity results (one per candidate), or
+   *          {@link TypedArrayResults} when `resultFormat: 'typed-array'`
+   *          is set
+   *
+   * @example
+   * ```typescript
+   * import { calculateOneToMany, AlgorithmType } from 'text-similarity-node';
+   *
+   * const results = calculateOneToMany('hello', ['hallo', 'hullo', 'world']);
+   * results.forEach((result, index) => {
+   *   if (result.success) {
+   *     console.log(`Candidate ${index}: ${result.value}`);
+   *   }
+   * });
+   * ```
+   */
+  export function calculateOneToMany(
+    query: StringLike,
+    candidates: StringLike[],
+    algorithm?: AlgorithmType | string,
+    config?: AlgorithmConfig,
+  ): SimilarityResult[] | TypedArrayResults;
+
+  /**
+   * Calculate similarity of one query against a packed candidate buffer
+   *
+   * Candidates are passed as a single concatenated UTF-8 buffer plus a
+   * Uint32Array of n+1 byte offsets (candidate i spans
+   * [offsets[i], offsets[i+1])), so a large candidate set crosses the
+   * JS/C++ boundary as two typed arrays instead of n string copies.
+   *
+   * @param query Query string or UTF-8 buffer
+   * @param buffer Concatenated UTF-8 bytes of all candidates
+   * @param offsets Byte boundaries into the buffer (length n+1)
+   * @param algorithm Algorithm to use (default: Levenshtein)
+   * @param config Additional configuration options
+   * @returns Array of similarity results (one per candidate)
+   *
+   * @example
+   * ```typescript
+   * import { calculateOneToManyPacked } from 'text-similarity-node';
+   *
+   * const candidates = ['hallo', 'hullo', 'world'];
+   * const encoder = new TextEncoder();
+   * const parts = candidates.map((c) => encoder.encode(c));
+   * const offsets = new Uint32Array(parts.length + 1);
+   * parts.forEach((part, i) => (offsets[i + 1] = offsets[i] + part.length));
+   * const buffer = new Uint8Array(offsets[parts.length]);
+   * parts.forEach((part, i) => buffer.set(part, offsets[i]));
+   *
+   * const results = calculateOneToManyPacked('hello', buffer, offsets);
+   * ```
+   */
+  export function calculateOneToManyPacked(
+    query: StringLike,
+    buffer: Uint8Array,
+    offsets: Uint32Array,
+    algorithm?: AlgorithmType | string,
+    config?: AlgorithmConfig,
   ): SimilarityResult[];
 
+  /**
+   * Single match returned by top-K queries
+   */
+  export interface TopKMatch {
+    /** Position of the match in the candidate array */
+    index: number;
+
+    /** Similarity score (0-1) */
+    similarity: number;
+  }
+
+  /**
+   * Find the K most similar candidates to a query string
+   *
+   * Maintains a bounded min-heap of the current top K and feeds the running
+   * Kth-best score into the algorithms' early-termination machinery, so for
+   * distance-based algorithms most candidates bail out after a few DP rows.
+   * Results are sorted best first.
+   *
+   * @param query Query string to match against
+   * @param candidates Array of candidate strings
+   * @param k Maximum number of matches to return
+   * @param minSimilarity Minimum similarity for a candidate to qualify (default: 0)
+   * @param algorithm Algorithm to use (default: Levenshtein)
+   * @param config Additional configuration options
+   * @returns Array of matches sorted by descending similarity
+   *
+   * @example
+   * ```typescript
+   * import { findTopK } from 'text-similarity-node';
+   *
+   * const matches = findTopK('aple', products, 10, 0.85);
+   * matches.forEach(({ index, similarity }) => {
+   *   console.log(`${products[index]}: ${similarity}`);
+   * });
+   * ```
+   */
+  export function findTopK(
+    query: string,
+    candidates: string[],
+    k: number,
+    minSimilarity?: number,
+    algorithm?: AlgorithmType | string,
+    config?: AlgorithmConfig,
+  ): TopKMatch[];
+
+  /**
+   * Find the K most similar candidates asynchronously
+   *
+   * Same semantics as {@link findTopK}, executed off the main thread.
+   *
+   * @param query Query string to match against
+   * @param candidates Array of candidate strings
+   * @param k Maximum number of matches to return
+   * @param minSimilarity Minimum similarity for a candidate to qualify (default: 0)
+   * @param algorithm Algorithm to use (default: Levenshtein)
+   * @param config Additional configuration options
+   * @returns Promise resolving to matches sorted by descending similarity
+   */
+  export function findTopKAsync(
+    query: string,
+    candidates: string[],
+    k: number,
+    minSimilarity?: number,
+    algorithm?: AlgorithmType | string,
+    config?: AlgorithmConfig,
+  ): Promise<TopKMatch[]>;
+
+  /**
+   * Compute the all-pairs similarity matrix of one corpus
+   *
+   * Each string is converted and prepared once, symmetric algorithms only
+   * compute the upper triangle, and the result is a dense row-major
+   * Float64Array (cell [i][j] at index i * n + j) instead of per-cell
+   * objects — the right shape for deduplication jobs. Failed cells are NaN;
+   * the diagonal is 1.
+   *
+   * @param strings Corpus of strings to compare pairwise
+   * @param algorithm Algorithm to use (default: Levenshtein)
+   * @param config Additional configuration options (supports concurrency)
+   * @returns Row-major n*n Float64Array of similarity values
+   *
+   * @example
+   * ```typescript
+   * import { similarityMatrix } from 'text-similarity-node';
+   *
+   * const corpus = ['hello', 'hallo', 'world'];
+   * const matrix = similarityMatrix(corpus);
+   * const n = corpus.length;
+   * console.log(matrix[0 * n + 1]); // similarity of 'hello' vs 'hallo'
+   * ```
+   */
+  export function similarityMatrix(
+    strings: string[],
+    algorithm?: AlgorithmType | string,
+    config?: AlgorithmConfig,
+  ): Float64Array;
+
+  /**
+   * Reusable similarity session bound to a single algorithm
+   *
+   * Created by {@link createSession}. The algorithm instance and merged
+   * configuration live for the lifetime of the session, so repeated calls
+   * skip the per-call factory allocation and configuration merge.
+   */
+  export interface SimilaritySession {
+    /** Calculate similarity between two strings using the session algorithm */
+    similarity(s1: string, s2: string): SimilarityResult;
+
+    /** Calculate distance between two strings using the session algorithm */
+    distance(s1: string, s2: string): DistanceResult;
+
+    /** Algorithm type enum value this session is bound to */
+    algorithmType: AlgorithmType;
+
+    /** Human-readable name of the session algorithm */
+    algorithmName: string;
+
+    /** Get the merged configuration the session was created with */
+    getConfiguration(): AlgorithmConfig;
+  }
+
+  /**
+   * Create a reusable session for repeated comparisons with one algorithm
+   *
+   * The algorithm object is created and the configuration merged once at
+   * session creation, making this the fastest option for tight loops that
+   * would otherwise pay those costs on every calculateSimilarity call.
+   *
+   * @param algorithm Algorithm to use for all session calls
+   * @param config Additional configuration options
+   * @returns Session object with similarity/distance methods
+   *
+   * @example
+   * ```typescript
+   * import { createSession, AlgorithmType } from 'text-similarity-node';
+   *
+   * const session = createSession(AlgorithmType.JARO_WINKLER, { prefixWeight: 0.1 });
+   * for (const name of names) {
+   *   const result = session.similarity('jonathan', name);
+   *   if (result.success && result.value > 0.9) {
+   *     console.log(`Match: ${name}`);
+   *   }
+   * }
+   * ```
+   */
+  export function createSession(
+    algorithm: AlgorithmType | string,
+    config?: AlgorithmConfig,
+  ): SimilaritySession;
+
+  /**
+   * Stateful matcher for queries that grow one character at a time
+   *
+   * Created by {@link createIncrementalMatcher}. Each candidate retains the
+   * edit-distance DP rows computed for the current query, so an update that
+   * appends characters to the previous query only computes the appended rows
+   * instead of rescoring every candidate from scratch.
+   */
+  export interface IncrementalMatcher {
+    /**
+     * Score all candidates against the new query and return the top matches
+     * best first.
+     *
+     * Cheapest when the query extends the previous one (the common case for
+     * autocomplete); on backspace or replacement only the shared prefix of
+     * the DP state is reused.
+     *
+     * @param query Current query text
+     * @param k Maximum number of matches to return (default: all candidates)
+     * @param minSimilarity Minimum similarity threshold (default: 0.0)
+     */
+    update(query: string, k?: number, minSimilarity?: number): TopKMatch[];
+
+    /** Discard the retained DP state (e.g. when the input field is cleared) */
+    reset(): void;
+
+    /** Number of candidate strings the matcher was created with */
+    candidateCount: number;
+
+    /** Algorithm type enum value this matcher is bound to */
+    algorithmType: AlgorithmType;
+
+    /** Human-readable name of the matcher algorithm */
+    algorithmName: string;
+  }
+
+  /**
+   * Create an incremental matcher over a fixed candidate set
+   *
+   * Designed for autocomplete: as the user types, each keystroke appends one
+   * character to the query, and update() reuses the per-candidate DP rows
+   * from the previous call so only one new row per candidate is computed.
+   * Only the edit-distance algorithms support row reuse; anything other than
+   * LEVENSHTEIN or DAMERAU_LEVENSHTEIN throws.
+   *
+   * @param candidates Candidate strings to score on every update
+   * @param algorithm Edit-distance algorithm (default: LEVENSHTEIN)
+   * @param config Additional configuration options
+   * @returns Matcher object with update/reset methods
+   *
+   * @example
+   * ```typescript
+   * import { createIncrementalMatcher } from 'text-similarity-node';
+   *
+   * const matcher = createIncrementalMatcher(cityNames);
+   * input.addEventListener('input', () => {
+   *   const matches = matcher.update(input.value, 5, 0.3);
+   *   render(matches.map((m) => cityNames[m.index]));
+   * });
+   * ```
+   */
+  export function createIncrementalMatcher(
+    candidates: string[],
+    algorithm?: AlgorithmType | string,
+    config?: AlgorithmConfig,
+  ): IncrementalMatcher;
+
+  /** One stage of a {@link createCascade} pipeline */
+  export interface CascadeStage {
+    /** Algorithm this stage scores pairs with */
+    algorithm: AlgorithmType | string;
+
+    /** Additional configuration for this stage's algorithm */
+    config?: AlgorithmConfig;
+
+    /** Score a pair must reach to advance past this stage (default: 0) */
+    minScore?: number;
+  }
+
+  /** Result of running one pair through a cascade */
+  export interface CascadeOutcome {
+    /** Whether the evaluation succeeded */
+    success: boolean;
+
+    /** True when every stage reached its cutoff */
+    passed?: boolean;
+
+    /** Index of the last stage that ran (the failing or final one) */
+    stage?: number;
+
+    /** Score from that stage */
+    score?: number;
+
+    /** Error information if failed */
+    error?: Error;
+  }
+
+  /**
+   * Staged scoring pipeline bound to a fixed stage list
+   *
+   * Created by {@link createCascade}. Stages run in order inside one
+   * native call; a pair stops at the first stage whose score falls below
+   * that stage's `minScore`, and input strings are converted and
+   * preprocessed once instead of once per stage round-trip.
+   */
+  export interface SimilarityCascade {
+    /** Number of stages in the pipeline */
+    stageCount: number;
+
+    /** Run one pair through the stages */
+    similarity(s1: StringLike, s2: StringLike): CascadeOutcome;
+
+    /** Run each pair through the stages */
+    similarityBatch(pairs: Array<[string, string]>): CascadeOutcome[];
+
+    /**
+     * One query against a candidate set: each stage scores only the
+     * survivors of the previous one, with the query prepared once per
+     * stage. Returns the candidates that passed every stage with their
+     * final-stage scores, best first.
+     */
+    match(query: StringLike, candidates: string[]): TopKMatch[];
+  }
+
+  /**
+   * Create a multi-stage scoring cascade
+   *
+   * Replaces the hand-rolled screen-then-confirm pattern (cheap metric
+   * first, expensive metric only for survivors) with one native call:
+   * stage algorithms are created once, and evaluation short-circuits at
+   * the first stage that cuts a pair.
+   *
+   * @param stages Stages in evaluation order, cheapest first
+   * @returns Cascade object with similarity/similarityBatch/match methods
+   *
+   * @example
+   * ```typescript
+   * import { createCascade, AlgorithmType } from 'text-similarity-node';
+   *
+   * const cascade = createCascade([
+   *   { algorithm: AlgorithmType.JARO_WINKLER, minScore: 0.8 },
+   *   { algorithm: AlgorithmType.DAMERAU_LEVENSHTEIN, minScore: 0.9 },
+   * ]);
+   * const outcome = cascade.similarity('jonathan', 'johnathan');
+   * if (outcome.success && outcome.passed) {
+   *   console.log(`Confirmed at ${outcome.score}`);
+   * }
+   * ```
+   */
+  export function createCascade(stages: CascadeStage[]): SimilarityCascade;
+
+  /**
+   * Precomputed profile of one document bound to a single algorithm
+   *
+   * Created by {@link createProfile}. Normalization, tokenization and
+   * frequency-vector construction are paid once at creation; comparisons
+   * against another profile reuse the precomputed state on both sides.
+   */
+  export interface DocumentProfile {
+    /**
+     * Compare against another profile (both sides precomputed) or against
+     * raw text (only the text side is tokenized per call).
+     *
+     * Both profiles must have been created for the same algorithm.
+     */
+    similarity(other: DocumentProfile | StringLike): SimilarityResult;
+
+    /** Algorithm type enum value this profile is bound to */
+    algorithmType: AlgorithmType;
+
+    /** Human-readable name of the profile algorithm */
+    algorithmName: string;
+
+    /** Get the merged configuration the profile was created with */
+    getConfiguration(): AlgorithmConfig;
+  }
+
+  /**
+   * Create a precomputed profile for a document that is compared many times
+   *
+   * Best suited for mostly-static reference sets: build profiles for the
+   * reference documents once, then score each incoming record against them
+   * without re-tokenizing the reference side on every call. Most effective
+   * with the token and vector algorithms (Jaccard, Dice, Overlap, Tversky,
+   * Cosine, Euclidean, Manhattan, Chebyshev).
+   *
+   * @param text Document text (string or UTF-8 buffer)
+   * @param algorithm Algorithm the profile is bound to
+   * @param config Additional configuration options
+   * @returns Profile object with a similarity method
+   *
+   * @example
+   * ```typescript
+   * import { createProfile, AlgorithmType } from 'text-similarity-node';
+   *
+   * const references = corpus.map((doc) =>
+   *   createProfile(doc, AlgorithmType.COSINE, { preprocessing: 'word' }),
+   * );
+   * const incoming = createProfile(record, AlgorithmType.COSINE, { preprocessing: 'word' });
+   * const best = references.reduce((a, b) =>
+   *   a.similarity(incoming).value >= b.similarity(incoming).value ? a : b,
+   * );
+   * ```
+   */
+  export function createProfile(
+    text: StringLike,
+    algorithm?: AlgorithmType | string,
+    config?: AlgorithmConfig,
+  ): DocumentProfile;
+
+  // ============================================================================
+  // CORPUS INDEX API
+  // ============================================================================
+
+  /**
+   * Persistent corpus index handle
+   *
+   * Created by {@link loadIndex}. Documents are stored preprocessed and
+   * pre-tokenized in a memory-mapped file, so queries skip per-document
+   * tokenization and a process restart skips the corpus rebuild entirely.
+   */
+  export interface CorpusIndex {
+    /** Number of documents in the index */
+    size: number;
+
+    /**
+     * Score the query against every indexed document.
+     *
+     * The preprocessing settings the index was built with override the
+     * corresponding fields of the passed configuration.
+     */
+    oneToMany(
+      query: StringLike,
+      algorithm?: AlgorithmType | string,
+      config?: AlgorithmConfig,
+    ): SimilarityResult[];
+
+    /**
+     * Find the K most similar indexed documents, best first. Match indexes
+     * refer to the document order the index was built with.
+     */
+    findTopK(
+      query: StringLike,
+      k: number,
+      minSimilarity?: number,
+      algorithm?: AlgorithmType | string,
+      config?: AlgorithmConfig,
+    ): TopKMatch[];
+
+    /** Get the preprocessing configuration the index was built with */
+    getConfiguration(): AlgorithmConfig;
+  }
+
+  /**
+   * Build a persistent corpus index file
+   *
+   * Each document is preprocessed and tokenized exactly once and written in
+   * a binary layout that {@link loadIndex} can memory-map directly. The
+   * preprocessing settings in `config` are baked into the file; queries
+   * against the index always use them.
+   *
+   * The file format is native-endian and version-checked; move index files
+   * between machines of the same architecture only.
+   *
+   * @param strings Documents to index
+   * @param path Destination file path
+   * @param config Preprocessing configuration to bake into the index
+   */
+  export function buildIndex(
+    strings: string[],
+    path: string,
+    config?: AlgorithmConfig,
+  ): void;
+
+  /**
+   * Open a corpus index file via memory mapping
+   *
+   * @param path Index file written by {@link buildIndex}
+   * @returns Index handle with query methods
+   * @throws Error if the file is missing, truncated or has an unsupported
+   *         format version
+   *
+   * @example
+   * ```typescript
+   * import { buildIndex, loadIndex, AlgorithmType } from 'text-similarity-node';
+   *
+   * buildIndex(products, 'products.tsix', { preprocessing: 'ngram', ngramSize: 2 });
+   * const index = loadIndex('products.tsix');
+   * const matches = index.findTopK('aple', 10, 0.3, AlgorithmType.JACCARD);
+   * ```
+   */
+  export function loadIndex(path: string): CorpusIndex;
+
+  /**
+   * In-memory inverted index handle
+   *
+   * Created by {@link createInvertedIndex}. Maps token fingerprints to
+   * posting lists of document IDs, so a query touches only the documents
+   * that share at least one token with it instead of scoring the whole
+   * corpus.
+   */
+  export interface InvertedIndex {
+    /** Number of documents in the index */
+    size: number;
+
+    /**
+     * Retrieve and score every document that can reach `minSimilarity`,
+     * best first.
+     *
+     * Count filtering derives a minimum shared-token bound from the
+     * threshold, so most non-matches are discarded from the posting lists
+     * alone; survivors are scored exactly. Documents sharing no tokens with
+     * the query are never returned.
+     *
+     * @param query Query text (string or UTF-8 buffer)
+     * @param minSimilarity Minimum similarity threshold (0.0 - 1.0)
+     * @param algorithm JACCARD (default) or SORENSEN_DICE
+     */
+    query(
+      query: StringLike,
+      minSimilarity?: number,
+      algorithm?: AlgorithmType | string,
+    ): TopKMatch[];
+  }
+
+  /**
+   * Build an in-memory inverted index for sub-linear fuzzy lookup
+   *
+   * Tokenizes each document once and indexes its token fingerprints.
+   * Worthwhile when the same corpus is queried many times: a lookup costs a
+   * handful of posting-list walks plus a few exact verifications instead of
+   * a full scan.
+   *
+   * @param strings Documents to index
+   * @param config Preprocessing configuration (defaults to bigram NGRAM mode)
+   *
+   * @example
+   * ```typescript
+   * import { createInvertedIndex, AlgorithmType } from 'text-similarity-node';
+   *
+   * const index = createInvertedIndex(products, { preprocessing: 'ngram', ngramSize: 2 });
+   * const matches = index.query('aple', 0.4, AlgorithmType.JACCARD);
+   * ```
+   */
+  export function createInvertedIndex(
+    strings: string[],
+    config?: AlgorithmConfig,
+  ): InvertedIndex;
+
+  /**
+   * MinHash signature index with locality-sensitive hashing
+   *
+   * Created by {@link buildSignatures}. Each document is reduced to a
+   * compact MinHash signature; the signatures are banded into an LSH table
+   * so a query only touches documents sharing at least one band bucket.
+   * All returned similarities are exact Jaccard scores — candidates are
+   * re-verified with the real algorithm, so the approximation only affects
+   * recall near the threshold, never the reported values.
+   */
+  export interface MinHashIndex {
+    /** Number of documents in the index */
+    size: number;
+
+    /** MinHash signature length (permutation count) */
+    permutations: number;
+
+    /** Number of LSH bands the signatures are split into */
+    bands: number;
+
+    /**
+     * Retrieve documents whose exact Jaccard similarity with the query
+     * reaches `minSimilarity`, restricted to LSH candidates, best first.
+     *
+     * @param query Query text (string or UTF-8 buffer)
+     * @param minSimilarity Minimum similarity threshold (0.0 - 1.0)
+     */
+    queryNear(query: StringLike, minSimilarity?: number): TopKMatch[];
+
+    /**
+     * Group the indexed documents into duplicate clusters connected by
+     * pairs whose exact Jaccard similarity reaches `minSimilarity`. Only
+     * groups with two or more members are returned.
+     *
+     * @param minSimilarity Minimum similarity threshold (0.0 - 1.0)
+     * @returns Arrays of document indices, each sorted ascending
+     */
+    deduplicate(minSimilarity: number): number[][];
+
+    /**
+     * MinHash estimate of the Jaccard similarity between two indexed
+     * documents (fraction of equal signature slots) — no exact scoring
+     */
+    estimateSimilarity(i: number, j: number): number;
+  }
+
+  /**
+   * Build a MinHash/LSH signature index for approximate Jaccard lookup
+   *
+   * Designed for corpora too large for exact all-pairs scoring: signature
+   * construction is linear in corpus size, and lookups touch only the
+   * documents landing in the same LSH buckets as the query. Defaults to
+   * 128 permutations in 32 bands (tune with `minhashPermutations` and
+   * `lshBands`; the band count must divide the permutation count — more
+   * bands raise recall at lower thresholds, fewer bands cut candidates).
+   *
+   * @param strings Documents to index
+   * @param config Preprocessing configuration (defaults to bigram NGRAM mode)
+   *
+   * @example
+   * ```typescript
+   * import { buildSignatures } from 'text-similarity-node';
+   *
+   * const index = buildSignatures(records, { ngramSize: 3 });
+   * const near = index.queryNear(incoming, 0.7);
+   * const clusters = index.deduplicate(0.8);
+   * ```
+   */
+  export function buildSignatures(
+    strings: string[],
+    config?: AlgorithmConfig,
+  ): MinHashIndex;
+
+  /**
+   * One-shot duplicate clustering over a string array
+   *
+   * Convenience wrapper that builds a {@link MinHashIndex} and returns
+   * `deduplicate(threshold)` on it. Use buildSignatures directly when the
+   * same corpus is also queried.
+   *
+   * @param strings Documents to cluster
+   * @param threshold Minimum exact Jaccard similarity for two documents to
+   *                  belong to the same cluster
+   * @param config Preprocessing configuration (defaults to bigram NGRAM mode)
+   * @returns Arrays of document indices, each sorted ascending
+   */
+  export function deduplicate(
+    strings: string[],
+    threshold: number,
+    config?: AlgorithmConfig,
+  ): number[][];
+
   // ============================================================================
   // ASYNCHRONOUS (PROMISE-BASED) API
   // ============================================================================
@@ -314,7 +1044,65 @@ declare module "text-similarity-node" {
     pairs: [string, string][],
     algorithm?: AlgorithmType | string,
     config?: AlgorithmConfig,
-  ): Promise<number[]>;
+  ): Promise<number[] | TypedArrayResults>;
+
+  /**
+   * Calculate similarity of one query string against many candidates
+   * (asynchronous)
+   *
+   * With `resultFormat: 'typed-array'` the scores are written into the
+   * Float64Array backing store off the main thread, so resolving a large
+   * result costs O(1) main-thread work instead of one JS number per
+   * candidate.
+   *
+   * @param query Query string to compare
+   * @param candidates Array of candidate strings
+   * @param algorithm Algorithm to use (default: Levenshtein)
+   * @param config Additional configuration options (supports resultFormat)
+   * @returns Promise resolving to array of similarity values, or to
+   *          {@link TypedArrayResults} when `resultFormat: 'typed-array'`
+   *          is set
+   *
+   * @example
+   * ```typescript
+   * import { calculateOneToManyAsync } from 'text-similarity-node';
+   *
+   * const results = await calculateOneToManyAsync('hello', ['hallo', 'hullo']);
+   * results.forEach((similarity, index) => {
+   *   console.log(`Candidate ${index}: ${similarity}`);
+   * });
+   * ```
+   */
+  export function calculateOneToManyAsync(
+    query: string,
+    candidates: string[],
+    algorithm?: AlgorithmType | string,
+    config?: AlgorithmConfig,
+  ): Promise<number[] | TypedArrayResults>;
+
+  /**
+   * Compute the all-pairs similarity matrix asynchronously
+   *
+   * Same semantics as {@link similarityMatrix}, executed off the main
+   * thread and resolved with the row-major Float64Array.
+   *
+   * @param strings Corpus of strings to compare pairwise
+   * @param algorithm Algorithm to use (default: Levenshtein)
+   * @param config Additional configuration options (supports concurrency)
+   * @returns Promise resolving to the row-major n*n Float64Array
+   *
+   * @example
+   * ```typescript
+   * import { similarityMatrixAsync } from 'text-similarity-node';
+   *
+   * const matrix = await similarityMatrixAsync(records, 'jaro_winkler');
+   * ```
+   */
+  export function similarityMatrixAsync(
+    strings: string[],
+    algorithm?: AlgorithmType | string,
+    config?: AlgorithmConfig,
+  ): Promise<Float64Array>;
 
   // ============================================================================
   // CONFIGURATION AND UTILITY FUNCTIONS
@@ -358,6 +1146,198 @@ declare module "text-similarity-node" {
    */
   export function getMemoryUsage(): number;
 
+  /**
+   * Result cache counters
+   */
+  export interface CacheStatistics {
+    /** Number of lookups answered from the cache */
+    hits: number;
+
+    /** Number of lookups that missed the cache */
+    misses: number;
+
+    /** Number of entries evicted to make room for new results */
+    evictions: number;
+
+    /** Current number of cached entries */
+    entries: number;
+
+    /** Maximum number of entries the cache can hold */
+    capacity: number;
+  }
+
+  /**
+   * Get result cache hit/miss/eviction counters
+   *
+   * @returns Cache statistics snapshot
+   *
+   * @example
+   * ```typescript
+   * import { getCacheStatistics } from 'text-similarity-node';
+   *
+   * const stats = getCacheStatistics();
+   * console.log(`Hit rate: ${stats.hits / (stats.hits + stats.misses)}`);
+   * ```
+   */
+  export function getCacheStatistics(): CacheStatistics;
+
+  /**
+   * Candidate prefilter counters
+   */
+  export interface PrefilterStatistics {
+    /** Number of candidate pairs the prefilter was consulted for */
+    considered: number;
+
+    /** Number of candidates rejected without running the full computation */
+    skipped: number;
+  }
+
+  /**
+   * Get candidate prefilter counters
+   *
+   * The prefilter runs on edit-distance algorithms (Levenshtein,
+   * Damerau-Levenshtein) whenever a distance `threshold` is configured or a
+   * top-K cutoff is active: candidates whose length difference or character
+   * frequencies already prove the threshold unreachable are skipped before
+   * any dynamic programming work.
+   *
+   * @returns Prefilter statistics snapshot
+   *
+   * @example
+   * ```typescript
+   * import { calculateOneToMany, getPrefilterStatistics, AlgorithmType } from 'text-similarity-node';
+   *
+   * calculateOneToMany('hello', candidates, AlgorithmType.LEVENSHTEIN, { threshold: 2 });
+   * const stats = getPrefilterStatistics();
+   * console.log(`Skipped ${stats.skipped} of ${stats.considered} candidates`);
+   * ```
+   */
+  export function getPrefilterStatistics(): PrefilterStatistics;
+
+  /**
+   * Async executor counters
+   */
+  export interface ExecutorStatistics {
+    /** Number of worker threads */
+    workerCount: number;
+
+    /** Tasks queued but not yet picked up by a worker */
+    pendingTasks: number;
+
+    /** Tasks completed since startup */
+    executedTasks: number;
+
+    /** Tasks a worker took from another worker's queue */
+    steals: number;
+
+    /** Total nanoseconds tasks spent queued before running */
+    taskWaitNs: number;
+  }
+
+  /**
+   * Get async executor queue-depth and work-stealing counters
+   *
+   * @returns Executor statistics snapshot
+   *
+   * @example
+   * ```typescript
+   * import { getExecutorStatistics } from 'text-similarity-node';
+   *
+   * const stats = getExecutorStatistics();
+   * console.log(`${stats.pendingTasks} queued across ${stats.workerCount} workers`);
+   * ```
+   */
+  export function getExecutorStatistics(): ExecutorStatistics;
+
+  /**
+   * Per-algorithm timing counters
+   */
+  export interface AlgorithmStatistics {
+    /** Timed calls recorded for this algorithm */
+    calls: number;
+
+    /** Total time spent in this algorithm, in nanoseconds */
+    totalTimeNs: number;
+
+    /** Mean call duration in nanoseconds */
+    avgTimeNs: number;
+
+    /**
+     * Power-of-two latency histogram: element i counts calls whose duration
+     * fell in [2^i, 2^(i+1)) nanoseconds
+     */
+    latencyHistogramNs: number[];
+  }
+
+  /**
+   * Combined engine statistics snapshot
+   */
+  export interface EngineStatistics {
+    /** Per-algorithm counters, keyed by algorithm name; algorithms that
+     * have never run are omitted */
+    algorithms: Record<string, AlgorithmStatistics>;
+
+    /** Result cache counters with a derived hit rate */
+    cache: {
+      hits: number;
+      misses: number;
+      evictions: number;
+      entries: number;
+      /** hits / (hits + misses), or 0 before the first lookup */
+      hitRate: number;
+    };
+
+    /** Candidate prefilter counters */
+    prefilter: PrefilterStatistics;
+
+    /** Async executor counters */
+    executor: ExecutorStatistics;
+
+    /** Memory footprint counters */
+    memory: {
+      /** Engine-owned memory (caches, pools), in bytes */
+      engineBytes: number;
+
+      /** Scratch arena blocks currently reserved across all threads */
+      arenaReservedBytes: number;
+
+      /** High-water mark of arena reservations since startup */
+      arenaPeakBytes: number;
+    };
+  }
+
+  /**
+   * Get a combined snapshot of all engine statistics in one call
+   *
+   * Aggregates per-algorithm call counts and latency histograms, cache
+   * hit/miss/eviction counters, prefilter and executor counters, and
+   * memory footprint. Recording is lock-free on the hot path; only this
+   * aggregation takes a lock, so polling it from a monitoring loop does
+   * not slow down comparisons.
+   *
+   * @returns Engine statistics snapshot
+   *
+   * @example
+   * ```typescript
+   * import { calculateSimilarity, getStatistics } from 'text-similarity-node';
+   *
+   * calculateSimilarity('hello', 'hallo');
+   * const stats = getStatistics();
+   * console.log(stats.algorithms['Levenshtein'].calls);  // 1
+   * console.log(stats.cache.hitRate);
+   * ```
+   */
+  export function getStatistics(): EngineStatistics;
+
+  /**
+   * Reset all cumulative statistics counters to zero
+   *
+   * Clears per-algorithm histograms, cache and prefilter counters, and
+   * executor totals. Live state (cached entries, queued tasks, reserved
+   * arena blocks) is unaffected.
+   */
+  export function resetStatistics(): void;
+
   /**
    * Clear internal result caches
    */
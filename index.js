@@ -16,17 +16,52 @@ module.exports = {
   calculateSimilarity: addon.calculateSimilarity,
   calculateDistance: addon.calculateDistance,
   calculateSimilarityBatch: addon.calculateSimilarityBatch,
+  calculateOneToMany: addon.calculateOneToMany,
+  calculateOneToManyPacked: addon.calculateOneToManyPacked,
+  similarityMatrix: addon.similarityMatrix,
+  findTopK: addon.findTopK,
+
+  // Session API (reusable algorithm instance)
+  createSession: addon.createSession,
+
+  // Incremental matcher API (append-aware autocomplete scoring)
+  createIncrementalMatcher: addon.createIncrementalMatcher,
+
+  // Cascade API (staged cheap-to-expensive scoring in one native call)
+  createCascade: addon.createCascade,
+
+  // Profile API (tokenize once, compare many times)
+  createProfile: addon.createProfile,
+
+  // Corpus index API (persistent, memory-mapped)
+  buildIndex: addon.buildIndex,
+  loadIndex: addon.loadIndex,
+
+  // Inverted index API (sub-linear fuzzy lookup)
+  createInvertedIndex: addon.createInvertedIndex,
+
+  // MinHash/LSH API (approximate Jaccard at corpus scale)
+  buildSignatures: addon.buildSignatures,
+  deduplicate: addon.deduplicate,
 
   // Asynchronous API
   calculateSimilarityAsync: addon.calculateSimilarityAsync,
   calculateDistanceAsync: addon.calculateDistanceAsync,
   calculateSimilarityBatchAsync: addon.calculateSimilarityBatchAsync,
+  calculateOneToManyAsync: addon.calculateOneToManyAsync,
+  similarityMatrixAsync: addon.similarityMatrixAsync,
+  findTopKAsync: addon.findTopKAsync,
 
   // Configuration management
   setGlobalConfiguration: addon.setGlobalConfiguration,
   getGlobalConfiguration: addon.getGlobalConfiguration,
   getSupportedAlgorithms: addon.getSupportedAlgorithms,
   getMemoryUsage: addon.getMemoryUsage,
+  getCacheStatistics: addon.getCacheStatistics,
+  getPrefilterStatistics: addon.getPrefilterStatistics,
+  getExecutorStatistics: addon.getExecutorStatistics,
+  getStatistics: addon.getStatistics,
+  resetStatistics: addon.resetStatistics,
   clearCaches: addon.clearCaches,
 
   // Utility functions
@@ -1,4 +1,5 @@
 #include "base_algorithm.hpp"
+#include "../core/statistics.hpp"
 #include <chrono>
 #include <regex>
 #include <sstream>
@@ -85,6 +86,101 @@ BaseAlgorithm::calculate_distance(const Core::UnicodeString &s1,
   }
 }
 
+std::unique_ptr<Core::IPreparedQuery>
+BaseAlgorithm::prepare_query(const Core::UnicodeString &query) const {
+  // Get current configuration thread-safely
+  Core::AlgorithmConfig current_config;
+  {
+    std::shared_lock<std::shared_mutex> lock(config_mutex_);
+    current_config = config_;
+  }
+
+  auto prepared = std::make_unique<PreparedQuery>(
+      query, preprocess_string(query, current_config), current_config);
+  prepared->state = prepare_query_state(prepared->processed, current_config);
+
+  return prepared;
+}
+
+Core::SimilarityResult BaseAlgorithm::calculate_similarity_prepared(
+    const Core::IPreparedQuery &prepared,
+    const Core::UnicodeString &candidate) const {
+  auto start = std::chrono::high_resolution_clock::now();
+
+  try {
+    const auto &query = static_cast<const PreparedQuery &>(prepared);
+
+    // Quick answer optimization against the original query
+    if (auto quick_result =
+            get_quick_similarity_answer(query.original, candidate)) {
+      update_metrics(std::chrono::high_resolution_clock::now() - start);
+      return Core::SimilarityResult{*quick_result};
+    }
+
+    // Only the candidate side needs preprocessing; the query side was
+    // preprocessed once in prepare_query
+    auto processed_candidate = preprocess_string(candidate, query.config);
+
+    auto result =
+        compute_similarity_prepared_impl(query, processed_candidate,
+                                         query.config);
+
+    update_metrics(std::chrono::high_resolution_clock::now() - start);
+    return result;
+
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::Unknown, e.what()}};
+  }
+}
+
+Core::SimilarityResult BaseAlgorithm::calculate_similarity_profiles(
+    const Core::IPreparedQuery &profile1,
+    const Core::IPreparedQuery &profile2) const {
+  auto start = std::chrono::high_resolution_clock::now();
+
+  try {
+    const auto &p1 = static_cast<const PreparedQuery &>(profile1);
+    const auto &p2 = static_cast<const PreparedQuery &>(profile2);
+
+    // Quick answer optimization against the original texts
+    if (auto quick_result =
+            get_quick_similarity_answer(p1.original, p2.original)) {
+      update_metrics(std::chrono::high_resolution_clock::now() - start);
+      return Core::SimilarityResult{*quick_result};
+    }
+
+    // The left profile's configuration snapshot drives the comparison;
+    // the engine only pairs profiles built for the same algorithm
+    auto result = compute_similarity_profiles_impl(p1, p2, p1.config);
+
+    update_metrics(std::chrono::high_resolution_clock::now() - start);
+    return result;
+
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::Unknown, e.what()}};
+  }
+}
+
+std::unique_ptr<Core::IPreparedQuery>
+BaseAlgorithm::adopt_prepared_state(Core::UnicodeString processed,
+                                    std::shared_ptr<void> state) const {
+  // Get current configuration thread-safely
+  Core::AlgorithmConfig current_config;
+  {
+    std::shared_lock<std::shared_mutex> lock(config_mutex_);
+    current_config = config_;
+  }
+
+  // The caller guarantees the string is already preprocessed and the state
+  // matches what prepare_query_state would have produced (corpus index)
+  auto prepared = std::make_unique<PreparedQuery>(processed, processed,
+                                                  std::move(current_config));
+  prepared->state = std::move(state);
+  return prepared;
+}
+
 void BaseAlgorithm::update_configuration(const Core::AlgorithmConfig &config) {
   if (!validate_configuration(config)) {
     throw std::invalid_argument("Invalid configuration provided");
@@ -111,7 +207,7 @@ bool BaseAlgorithm::is_metric() const noexcept { return is_metric_impl(); }
 
 Core::UnicodeString
 BaseAlgorithm::preprocess_string(const Core::UnicodeString &input,
-                                 const Core::AlgorithmConfig &config) const {
+                                 const Core::AlgorithmConfig &config) {
   if (input.empty()) {
     return input;
   }
@@ -127,7 +223,7 @@ BaseAlgorithm::preprocess_string(const Core::UnicodeString &input,
 
 std::vector<Core::UnicodeString>
 BaseAlgorithm::tokenize_string(const Core::UnicodeString &input,
-                               const Core::AlgorithmConfig &config) const {
+                               const Core::AlgorithmConfig &config) {
   std::vector<Core::UnicodeString> tokens;
 
   switch (config.preprocessing) {
@@ -179,7 +275,7 @@ BaseAlgorithm::tokenize_string(const Core::UnicodeString &input,
 
 std::vector<std::u32string>
 BaseAlgorithm::generate_ngrams(const Core::UnicodeString &input,
-                               uint32_t n) const {
+                               uint32_t n) {
   std::vector<std::u32string> ngrams;
 
   if (n == 0 || input.empty()) {
@@ -322,6 +418,10 @@ void BaseAlgorithm::update_metrics(
     std::chrono::nanoseconds duration) const noexcept {
   call_count_.fetch_add(1, std::memory_order_relaxed);
   total_time_ns_.fetch_add(duration.count(), std::memory_order_relaxed);
+
+  // Every timed call also feeds the per-algorithm latency histograms
+  Core::AlgorithmMetrics::record(
+      get_algorithm_type(), static_cast<uint64_t>(duration.count()));
 }
 
 } // namespace TextSimilarity::Algorithms
\ No newline at end of file
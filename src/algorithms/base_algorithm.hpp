@@ -26,9 +26,38 @@ public:
   calculate_distance(const Core::UnicodeString &s1,
                      const Core::UnicodeString &s2) const override final;
 
+  [[nodiscard]] std::unique_ptr<Core::IPreparedQuery>
+  prepare_query(const Core::UnicodeString &query) const override final;
+
+  [[nodiscard]] Core::SimilarityResult calculate_similarity_prepared(
+      const Core::IPreparedQuery &prepared,
+      const Core::UnicodeString &candidate) const override final;
+
+  [[nodiscard]] Core::SimilarityResult calculate_similarity_profiles(
+      const Core::IPreparedQuery &profile1,
+      const Core::IPreparedQuery &profile2) const override final;
+
+  [[nodiscard]] std::unique_ptr<Core::IPreparedQuery>
+  adopt_prepared_state(Core::UnicodeString processed,
+                       std::shared_ptr<void> state) const override final;
+
   void update_configuration(const Core::AlgorithmConfig &config) override final;
   [[nodiscard]] Core::AlgorithmConfig get_configuration() const override final;
 
+  // Preprocessing utilities. These are pure functions of their inputs and
+  // public so the corpus index builder can produce token streams identical
+  // to what the algorithms consume at query time.
+  [[nodiscard]] static Core::UnicodeString
+  preprocess_string(const Core::UnicodeString &input,
+                    const Core::AlgorithmConfig &config);
+
+  [[nodiscard]] static std::vector<Core::UnicodeString>
+  tokenize_string(const Core::UnicodeString &input,
+                  const Core::AlgorithmConfig &config);
+
+  [[nodiscard]] static std::vector<std::u32string>
+  generate_ngrams(const Core::UnicodeString &input, uint32_t n);
+
   [[nodiscard]] bool supports_early_termination() const noexcept override;
   [[nodiscard]] bool is_symmetric() const noexcept override;
   [[nodiscard]] bool is_metric() const noexcept override;
@@ -45,38 +74,48 @@ protected:
                         const Core::UnicodeString &s2,
                         const Core::AlgorithmConfig &config) const = 0;
 
-  // Utility methods for derived classes
-  [[nodiscard]] Core::UnicodeString
-  preprocess_string(const Core::UnicodeString &input,
-                    const Core::AlgorithmConfig &config) const;
-
-  [[nodiscard]] std::vector<Core::UnicodeString>
-  tokenize_string(const Core::UnicodeString &input,
-                  const Core::AlgorithmConfig &config) const;
-
-  [[nodiscard]] std::vector<std::u32string>
-  generate_ngrams(const Core::UnicodeString &input, uint32_t n) const;
-
-  // Memory management
-  template <typename T>
-  [[nodiscard]] std::unique_ptr<T[], std::function<void(T *)>>
-  allocate_array(size_t count) const {
-    if (!memory_pool_) {
-      auto deleter = [](T *ptr) { delete[] ptr; };
-      return {new T[count], deleter};
-    }
-
-    // Use memory pool for POD types only (like uint32_t)
-    static_assert(std::is_trivial_v<T>,
-                  "Memory pool arrays only support trivial types");
-
-    size_t size = sizeof(T) * count;
-    void *ptr = memory_pool_->allocate(size, alignof(T));
-    T *arr = static_cast<T *>(ptr);
+  // Prepared query state shared by the one-to-many path. The configuration
+  // is snapshotted at preparation time so every candidate comparison sees a
+  // consistent view.
+  struct PreparedQuery final : public Core::IPreparedQuery {
+    Core::UnicodeString original;
+    Core::UnicodeString processed;
+    Core::AlgorithmConfig config;
+    std::shared_ptr<void> state; // Algorithm-specific precomputed data
+
+    PreparedQuery(Core::UnicodeString orig, Core::UnicodeString proc,
+                  Core::AlgorithmConfig cfg)
+        : original(std::move(orig)), processed(std::move(proc)),
+          config(std::move(cfg)) {}
+  };
+
+  // Hook for derived classes to precompute token/frequency structures for
+  // the query side (returns nullptr when there is nothing to precompute)
+  [[nodiscard]] virtual std::shared_ptr<void>
+  prepare_query_state(const Core::UnicodeString &processed_query,
+                      const Core::AlgorithmConfig &config) const {
+    (void)processed_query;
+    (void)config;
+    return nullptr;
+  }
 
-    auto deleter = [this, size](T *p) { memory_pool_->deallocate(p, size); };
+  // Hook for derived classes to compare against the precomputed query state
+  [[nodiscard]] virtual Core::SimilarityResult compute_similarity_prepared_impl(
+      const PreparedQuery &prepared,
+      const Core::UnicodeString &processed_candidate,
+      const Core::AlgorithmConfig &config) const {
+    return compute_similarity_impl(prepared.processed, processed_candidate,
+                                   config);
+  }
 
-    return {arr, deleter};
+  // Hook for derived classes to compare two precomputed profiles without
+  // re-tokenizing either side. The default reuses the prepared path, which
+  // is already optimal for algorithms that only need the processed strings.
+  [[nodiscard]] virtual Core::SimilarityResult compute_similarity_profiles_impl(
+      const PreparedQuery &profile1, const PreparedQuery &profile2,
+      const Core::AlgorithmConfig &config) const {
+    return compute_similarity_prepared_impl(profile1, profile2.processed,
+                                            config);
   }
 
   // Performance characteristics (to be overridden by derived classes)
@@ -101,6 +140,9 @@ protected:
 
 private:
   mutable std::shared_mutex config_mutex_;
+  // Kept for constructor compatibility; per-call scratch (DP rows, n-gram
+  // fingerprints) now comes from the thread-local bump arena, which takes
+  // no locks on the hot path
   std::shared_ptr<Core::IMemoryPool> memory_pool_;
   Core::AlgorithmConfig config_;
 
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace TextSimilarity::Algorithms::Kernels {
+
+// Compile-time case mode for the character kernels. The distance and match
+// loops are templated on this (and on the element type) so the mode is
+// decided once per call, at the dispatch site, instead of re-reading the
+// configuration for every character comparison.
+enum class CaseMode : uint8_t { Sensitive, Insensitive };
+
+// Simplified Unicode case folding shared by the char32_t kernels: ASCII,
+// Latin-1 supplement, Greek and Cyrillic uppercase ranges
+constexpr char32_t fold_codepoint(char32_t c) noexcept {
+  if (c >= U'A' && c <= U'Z') {
+    return c + 32;
+  }
+  if (c >= 0x00C0 && c <= 0x00DE && c != 0x00D7) {
+    return c + 32;
+  }
+  if (c >= 0x0391 && c <= 0x03A9) {
+    return c + 32;
+  }
+  if (c >= 0x0410 && c <= 0x042F) {
+    return c + 32;
+  }
+  return c;
+}
+
+// Character equality specialized on element width and case mode. The char
+// kernels assume pure-ASCII input — callers dispatch on the cached
+// UnicodeString::is_ascii() flag, so no per-character validation is needed —
+// and use the same | 0x20 fold as the byte-level SIMD kernels. The char32_t
+// insensitive kernel keeps the ASCII fast path so mixed strings with mostly
+// ASCII content pay the table-free comparison.
+template <typename CharT, CaseMode Mode> struct CharEq;
+
+template <> struct CharEq<char, CaseMode::Sensitive> {
+  static constexpr bool equal(char a, char b) noexcept { return a == b; }
+};
+
+template <> struct CharEq<char, CaseMode::Insensitive> {
+  static constexpr bool equal(char a, char b) noexcept {
+    return (a | 0x20) == (b | 0x20);
+  }
+};
+
+template <> struct CharEq<char32_t, CaseMode::Sensitive> {
+  static constexpr bool equal(char32_t a, char32_t b) noexcept {
+    return a == b;
+  }
+};
+
+template <> struct CharEq<char32_t, CaseMode::Insensitive> {
+  static constexpr bool equal(char32_t a, char32_t b) noexcept {
+    if (a < 128 && b < 128) {
+      return (static_cast<char>(a) | 0x20) == (static_cast<char>(b) | 0x20);
+    }
+    return fold_codepoint(a) == fold_codepoint(b);
+  }
+};
+
+} // namespace TextSimilarity::Algorithms::Kernels
@@ -45,38 +45,21 @@ protected:
   bool is_metric_impl() const noexcept override { return true; }
 
 private:
-  // Optimized implementations
+  // Scalar DP dispatcher for non-ASCII strings; the single-row and banded
+  // kernels themselves are compile-time specialized on case mode (see
+  // char_kernels.hpp) and selected here once per call
   [[nodiscard]] uint32_t
   compute_distance_optimized(const std::u32string &s1, const std::u32string &s2,
                              const Core::AlgorithmConfig &config) const;
 
-  // Memory-efficient single-row implementation
-  [[nodiscard]] uint32_t
-  compute_distance_single_row(const std::u32string &s1,
-                              const std::u32string &s2,
-                              const Core::AlgorithmConfig &config) const;
-
-  // Early termination implementation
-  [[nodiscard]] uint32_t compute_distance_with_threshold(
-      const std::u32string &s1, const std::u32string &s2, uint32_t max_distance,
-      const Core::AlgorithmConfig &config) const;
-
   // SIMD-optimized implementation for ASCII strings
   [[nodiscard]] uint32_t
   compute_distance_simd(const std::string &s1, const std::string &s2,
                         const Core::AlgorithmConfig &config) const;
 
-  // Character comparison with case sensitivity
-  [[nodiscard]] bool
-  characters_equal(char32_t c1, char32_t c2,
-                   const Core::AlgorithmConfig &config) const noexcept;
-
   // Similarity calculation from distance
   [[nodiscard]] double distance_to_similarity(uint32_t distance,
                                               size_t max_length) const noexcept;
-
-  // ASCII optimization detection
-  [[nodiscard]] bool is_ascii_string(const std::string &str) const noexcept;
 };
 
 // Damerau-Levenshtein with transposition support
@@ -116,17 +99,6 @@ protected:
   bool is_metric_impl() const noexcept override { return true; }
 
 private:
-  // Restricted Damerau-Levenshtein (Optimal String Alignment)
-  [[nodiscard]] uint32_t
-  compute_osa_distance(const std::u32string &s1, const std::u32string &s2,
-                       const Core::AlgorithmConfig &config) const;
-
-  // Unrestricted Damerau-Levenshtein (true metric)
-  [[nodiscard]] uint32_t
-  compute_unrestricted_distance(const std::u32string &s1,
-                                const std::u32string &s2,
-                                const Core::AlgorithmConfig &config) const;
-
   [[nodiscard]] double distance_to_similarity(uint32_t distance,
                                               size_t max_length) const noexcept;
 };
@@ -167,10 +139,6 @@ protected:
   bool is_metric_impl() const noexcept override { return true; }
 
 private:
-  [[nodiscard]] uint32_t
-  compute_hamming_distance(const std::u32string &s1, const std::u32string &s2,
-                           const Core::AlgorithmConfig &config) const;
-
   // SIMD-optimized version for ASCII
   [[nodiscard]] uint32_t
   compute_hamming_simd(const std::string &s1, const std::string &s2,
@@ -1,36 +1,219 @@
 #include "phonetic.hpp"
+#include "../core/memory_pool.hpp"
+#include "char_kernels.hpp"
 #include <algorithm>
+#include <string_view>
 
 namespace TextSimilarity::Algorithms {
 
 namespace {
-// Unicode-aware character equality check
-bool unicode_chars_equal(char32_t a, char32_t b, bool case_sensitive) noexcept {
-  if (case_sensitive) {
-    return a == b;
-  }
-
-  // Fast path for ASCII
-  if (a < 128 && b < 128) {
-    char ca = static_cast<char>(a);
-    char cb = static_cast<char>(b);
-    return (ca | 0x20) == (cb | 0x20);
-  }
-
-  // Unicode case folding (simplified)
-  auto fold = [](char32_t c) -> char32_t {
-    if (c >= 'A' && c <= 'Z')
-      return c + 32;
-    if (c >= 0x00C0 && c <= 0x00DE && c != 0x00D7)
-      return c + 32;
-    if (c >= 0x0391 && c <= 0x03A9)
-      return c + 32;
-    if (c >= 0x0410 && c <= 0x042F)
-      return c + 32;
-    return c;
-  };
-
-  return fold(a) == fold(b);
+using Kernels::CaseMode;
+using Kernels::CharEq;
+
+// Bit range [low, hi] within one 64-bit word
+uint64_t window_mask(size_t low, size_t hi) noexcept {
+  const size_t width = hi - low + 1;
+  const uint64_t bits = (width == 64) ? ~0ULL : ((1ULL << width) - 1);
+  return bits << low;
+}
+
+// Match bookkeeping shared by the kernels below; find_matches converts it
+// to the class-level MatchInfo
+struct Matches {
+  size_t match_count{0};
+  size_t transposition_count{0};
+};
+
+// Position-mask table key: the insensitive mode replicates the byte-level
+// | 0x20 fold used everywhere else, so both paths agree on which characters
+// are equal. char kernels see pure ASCII (callers dispatch on is_ascii()),
+// so every character is a valid table index.
+template <CaseMode Mode, typename CharT>
+constexpr size_t table_key(CharT c) noexcept {
+  if constexpr (Mode == CaseMode::Insensitive) {
+    return static_cast<size_t>(static_cast<uint32_t>(c) | 0x20);
+  } else {
+    return static_cast<size_t>(static_cast<uint32_t>(c));
+  }
+}
+
+// Strings up to 64 elements (the vast majority of name-matching inputs)
+// keep both match-flag sets in single stack-resident words and resolve
+// each window probe with mask arithmetic; each s1 character finds its
+// lowest admissible match with one AND of its bitap position mask and a
+// count of trailing zeros instead of probing the window position by
+// position. Non-ASCII characters in s2 are simply absent from the table:
+// they can never equal an ASCII character, and non-ASCII s1 characters
+// scan the candidate bits directly.
+template <typename CharT, CaseMode Mode>
+Matches find_matches_small(std::basic_string_view<CharT> s1,
+                           std::basic_string_view<CharT> s2,
+                           size_t search_range) {
+  const size_t len1 = s1.length();
+  const size_t len2 = s2.length();
+
+  Matches info;
+  uint64_t s1_matches = 0;
+  uint64_t s2_matches = 0;
+
+  uint64_t position_masks[128] = {};
+  for (size_t j = 0; j < len2; ++j) {
+    const CharT c = s2[j];
+    if (static_cast<uint32_t>(c) < 128) {
+      position_masks[table_key<Mode>(c)] |= 1ULL << j;
+    }
+  }
+
+  for (size_t i = 0; i < len1; ++i) {
+    const size_t low = (i >= search_range) ? i - search_range : 0;
+    const size_t hi = std::min(i + search_range, len2 - 1);
+    if (low > hi) {
+      continue; // Window fell entirely past the end of s2
+    }
+
+    // Positions still unmatched inside the window; already-claimed
+    // positions drop out in one mask operation
+    uint64_t candidates = window_mask(low, hi) & ~s2_matches;
+    if (candidates == 0) {
+      continue;
+    }
+
+    const CharT c = s1[i];
+    uint64_t hit = 0;
+    if (static_cast<uint32_t>(c) < 128) {
+      hit = candidates & position_masks[table_key<Mode>(c)];
+    } else {
+      while (candidates != 0) {
+        const size_t j = static_cast<size_t>(__builtin_ctzll(candidates));
+        if (CharEq<CharT, Mode>::equal(c, s2[j])) {
+          hit = candidates & (~candidates + 1); // Lowest candidate bit
+          break;
+        }
+        candidates &= candidates - 1;
+      }
+    }
+
+    if (hit != 0) {
+      s1_matches |= 1ULL << i;
+      s2_matches |= hit & (~hit + 1);
+      ++info.match_count;
+    }
+  }
+
+  // Walk the matched positions of both strings in parallel; each iteration
+  // clears one bit, so this touches exactly match_count positions
+  uint64_t m1 = s1_matches;
+  uint64_t m2 = s2_matches;
+  while (m1 != 0) {
+    const size_t i = static_cast<size_t>(__builtin_ctzll(m1));
+    const size_t k = static_cast<size_t>(__builtin_ctzll(m2));
+    if (!CharEq<CharT, Mode>::equal(s1[i], s2[k])) {
+      ++info.transposition_count;
+    }
+    m1 &= m1 - 1;
+    m2 &= m2 - 1;
+  }
+
+  // Transpositions are counted as pairs, so divide by 2
+  info.transposition_count /= 2;
+
+  return info;
+}
+
+// Same structure as the small path, but the match flags span multiple
+// words in the per-thread arena; fully matched words are skipped with a
+// single candidate test
+template <typename CharT, CaseMode Mode>
+Matches find_matches_large(std::basic_string_view<CharT> s1,
+                           std::basic_string_view<CharT> s2,
+                           size_t search_range) {
+  const size_t len1 = s1.length();
+  const size_t len2 = s2.length();
+
+  Matches info;
+
+  const size_t words1 = (len1 + 63) / 64;
+  const size_t words2 = (len2 + 63) / 64;
+  Core::ArenaScope scratch;
+  Core::PoolVector<uint64_t> s1_matches(words1, 0,
+                                        scratch.allocator<uint64_t>());
+  Core::PoolVector<uint64_t> s2_matches(words2, 0,
+                                        scratch.allocator<uint64_t>());
+
+  for (size_t i = 0; i < len1; ++i) {
+    const size_t low = (i >= search_range) ? i - search_range : 0;
+    const size_t hi = std::min(i + search_range, len2 - 1);
+    if (low > hi) {
+      continue; // Window fell entirely past the end of s2
+    }
+    const CharT c = s1[i];
+
+    bool found = false;
+    for (size_t w = low / 64; w <= hi / 64 && !found; ++w) {
+      uint64_t candidates = ~s2_matches[w];
+      if (w == low / 64) {
+        candidates &= ~0ULL << (low % 64);
+      }
+      if (w == hi / 64) {
+        candidates &= window_mask(0, hi % 64);
+      }
+
+      while (candidates != 0) {
+        const size_t bit = static_cast<size_t>(__builtin_ctzll(candidates));
+        const size_t j = w * 64 + bit;
+        if (CharEq<CharT, Mode>::equal(c, s2[j])) {
+          s1_matches[i / 64] |= 1ULL << (i % 64);
+          s2_matches[w] |= 1ULL << bit;
+          ++info.match_count;
+          found = true;
+          break;
+        }
+        candidates &= candidates - 1;
+      }
+    }
+  }
+
+  // Parallel walk over the matched positions, one word at a time
+  size_t w2 = 0;
+  uint64_t m2 = s2_matches[0];
+  for (size_t w1 = 0; w1 < words1; ++w1) {
+    uint64_t m1 = s1_matches[w1];
+    while (m1 != 0) {
+      const size_t i =
+          w1 * 64 + static_cast<size_t>(__builtin_ctzll(m1));
+      while (m2 == 0 && w2 + 1 < words2) {
+        m2 = s2_matches[++w2];
+      }
+      const size_t k = w2 * 64 + static_cast<size_t>(__builtin_ctzll(m2));
+      if (!CharEq<CharT, Mode>::equal(s1[i], s2[k])) {
+        ++info.transposition_count;
+      }
+      m1 &= m1 - 1;
+      m2 &= m2 - 1;
+    }
+  }
+
+  // Transpositions are counted as pairs, so divide by 2
+  info.transposition_count /= 2;
+
+  return info;
+}
+
+template <typename CharT>
+Matches dispatch_matches(std::basic_string_view<CharT> s1,
+                         std::basic_string_view<CharT> s2, size_t search_range,
+                         bool case_sensitive) {
+  if (s1.length() <= 64 && s2.length() <= 64) {
+    return case_sensitive
+               ? find_matches_small<CharT, CaseMode::Sensitive>(s1, s2,
+                                                                search_range)
+               : find_matches_small<CharT, CaseMode::Insensitive>(
+                     s1, s2, search_range);
+  }
+  return case_sensitive ? find_matches_large<CharT, CaseMode::Sensitive>(
+                              s1, s2, search_range)
+                        : find_matches_large<CharT, CaseMode::Insensitive>(
+                              s1, s2, search_range);
 }
 } // namespace
 
@@ -48,8 +231,7 @@ Core::SimilarityResult JaroAlgorithm::compute_similarity_impl(
       return Core::SimilarityResult{0.0};
     }
 
-    double similarity =
-        compute_jaro_similarity(s1.unicode(), s2.unicode(), config);
+    double similarity = compute_jaro_similarity(s1, s2, config);
     return Core::SimilarityResult{similarity};
 
   } catch (const std::exception &e) {
@@ -73,7 +255,7 @@ Core::DistanceResult JaroAlgorithm::compute_distance_impl(
 }
 
 double JaroAlgorithm::compute_jaro_similarity(
-    const std::u32string &s1, const std::u32string &s2,
+    const Core::UnicodeString &s1, const Core::UnicodeString &s2,
     const Core::AlgorithmConfig &config) const {
   const size_t len1 = s1.length();
   const size_t len2 = s2.length();
@@ -105,72 +287,45 @@ double JaroAlgorithm::compute_jaro_similarity(
 }
 
 JaroAlgorithm::MatchInfo
-JaroAlgorithm::find_matches(const std::u32string &s1, const std::u32string &s2,
+JaroAlgorithm::find_matches(const Core::UnicodeString &s1,
+                            const Core::UnicodeString &s2,
                             const Core::AlgorithmConfig &config) const {
-  const size_t len1 = s1.length();
-  const size_t len2 = s2.length();
-
-  MatchInfo info(len1, len2);
-
-  // Calculate matching window - following Python implementation
-  size_t search_range = std::max(len1, len2);
+  // Matching window, matching the reference implementation
+  size_t search_range = std::max(s1.length(), s2.length());
   search_range = (search_range / 2);
   if (search_range > 0) {
     search_range -= 1;
   }
 
-  // Find matches within the window - exactly like Python implementation
-  for (size_t i = 0; i < len1; ++i) {
-    size_t low = (i >= search_range) ? i - search_range : 0;
-    size_t hi = std::min(i + search_range, len2 - 1);
-
-    for (size_t j = low; j <= hi; ++j) {
-      if (info.s2_matches[j] || !characters_match(s1[i], s2[j], config)) {
-        continue;
-      }
-
-      // Found a match
-      info.s1_matches[i] = true;
-      info.s2_matches[j] = true;
-      ++info.match_count;
-      break;
-    }
-  }
-
-  // Count transpositions - following Python implementation exactly
-  size_t k = 0;
-  for (size_t i = 0; i < len1; ++i) {
-    if (info.s1_matches[i]) {
-      // Find next matched position in s2
-      while (k < len2 && !info.s2_matches[k]) {
-        ++k;
-      }
-      if (k < len2) {
-        if (!characters_match(s1[i], s2[k], config)) {
-          ++info.transposition_count;
-        }
-        ++k;
-      }
-    }
+  const bool case_sensitive =
+      config.case_sensitivity == Core::CaseSensitivity::Sensitive;
+
+  // Dispatch once to the kernel instantiation matching the input: ASCII
+  // pairs run on the UTF-8 bytes directly, everything else on UTF-32
+  Matches matches;
+  if (s1.is_ascii() && s2.is_ascii()) {
+    matches = dispatch_matches<char>(s1.utf8(), s2.utf8(), search_range,
+                                     case_sensitive);
+  } else {
+    matches = dispatch_matches<char32_t>(s1.unicode(), s2.unicode(),
+                                         search_range, case_sensitive);
   }
-
-  // Transpositions are counted as pairs, so divide by 2
-  info.transposition_count /= 2;
-
-  return info;
+  return MatchInfo{matches.match_count, matches.transposition_count};
 }
 
 bool JaroAlgorithm::characters_match(
     char32_t c1, char32_t c2,
     const Core::AlgorithmConfig &config) const noexcept {
-  return unicode_chars_equal(
-      c1, c2, config.case_sensitivity == Core::CaseSensitivity::Sensitive);
+  if (config.case_sensitivity == Core::CaseSensitivity::Sensitive) {
+    return CharEq<char32_t, CaseMode::Sensitive>::equal(c1, c2);
+  }
+  return CharEq<char32_t, CaseMode::Insensitive>::equal(c1, c2);
 }
 
 // JaroWinklerAlgorithm Implementation
 
 double JaroWinklerAlgorithm::compute_jaro_similarity(
-    const std::u32string &s1, const std::u32string &s2,
+    const Core::UnicodeString &s1, const Core::UnicodeString &s2,
     const Core::AlgorithmConfig &config) const {
   // First calculate Jaro similarity
   double jaro_sim = JaroAlgorithm::compute_jaro_similarity(s1, s2, config);
@@ -201,13 +356,31 @@ double JaroWinklerAlgorithm::compute_jaro_similarity(
 }
 
 size_t JaroWinklerAlgorithm::calculate_common_prefix_length(
-    const std::u32string &s1, const std::u32string &s2,
+    const Core::UnicodeString &s1, const Core::UnicodeString &s2,
     const Core::AlgorithmConfig &config, size_t max_length) const {
   size_t min_len = std::min({s1.length(), s2.length(), max_length});
   size_t prefix_length = 0;
 
+  // ASCII pairs walk the UTF-8 bytes; the prefix is at most a handful of
+  // characters, so this only avoids touching the lazy UTF-32 form
+  if (s1.is_ascii() && s2.is_ascii()) {
+    const std::string &a = s1.utf8();
+    const std::string &b = s2.utf8();
+    for (size_t i = 0; i < min_len; ++i) {
+      if (characters_match(static_cast<unsigned char>(a[i]),
+                           static_cast<unsigned char>(b[i]), config)) {
+        ++prefix_length;
+      } else {
+        break;
+      }
+    }
+    return prefix_length;
+  }
+
+  const std::u32string &a = s1.unicode();
+  const std::u32string &b = s2.unicode();
   for (size_t i = 0; i < min_len; ++i) {
-    if (characters_match(s1[i], s2[i], config)) {
+    if (characters_match(a[i], b[i], config)) {
       ++prefix_length;
     } else {
       break;
@@ -39,25 +39,24 @@ protected:
   bool is_symmetric_impl() const noexcept override { return true; }
 
 protected:
-  // Virtual to allow Jaro-Winkler to override
+  // Virtual to allow Jaro-Winkler to override. Takes the UnicodeString so
+  // the match loop can dispatch once to a byte-level kernel for ASCII input
+  // (see char_kernels.hpp) without materializing the UTF-32 form.
   [[nodiscard]] virtual double
-  compute_jaro_similarity(const std::u32string &s1, const std::u32string &s2,
+  compute_jaro_similarity(const Core::UnicodeString &s1,
+                          const Core::UnicodeString &s2,
                           const Core::AlgorithmConfig &config) const;
 
 protected:
+  // Match bookkeeping produced by find_matches; the flag buffers themselves
+  // are transient bitmasks and never leave the match kernels
   struct MatchInfo {
-    std::vector<bool> s1_matches;
-    std::vector<bool> s2_matches;
-    size_t match_count;
-    size_t transposition_count;
-
-    MatchInfo(size_t s1_len, size_t s2_len)
-        : s1_matches(s1_len, false), s2_matches(s2_len, false), match_count(0),
-          transposition_count(0) {}
+    size_t match_count{0};
+    size_t transposition_count{0};
   };
 
   [[nodiscard]] MatchInfo
-  find_matches(const std::u32string &s1, const std::u32string &s2,
+  find_matches(const Core::UnicodeString &s1, const Core::UnicodeString &s2,
                const Core::AlgorithmConfig &config) const;
 
   [[nodiscard]] bool
@@ -86,12 +85,13 @@ public:
 
 protected:
   [[nodiscard]] double
-  compute_jaro_similarity(const std::u32string &s1, const std::u32string &s2,
+  compute_jaro_similarity(const Core::UnicodeString &s1,
+                          const Core::UnicodeString &s2,
                           const Core::AlgorithmConfig &config) const override;
 
 private:
   [[nodiscard]] size_t calculate_common_prefix_length(
-      const std::u32string &s1, const std::u32string &s2,
+      const Core::UnicodeString &s1, const Core::UnicodeString &s2,
       const Core::AlgorithmConfig &config, size_t max_length = 4) const;
 
   [[nodiscard]] double
@@ -1,8 +1,150 @@
 #include "token_based.hpp"
+#include "../core/memory_pool.hpp"
 #include <algorithm>
 
 namespace TextSimilarity::Algorithms {
 
+// FlatCounter Implementation
+
+uint64_t FlatCounter::fingerprint(const std::u32string &token) noexcept {
+  // FNV-1a over the code points; fast and well distributed for the
+  // short n-grams and words the tokenizer produces
+  uint64_t hash = 14695981039346656037ULL;
+  for (char32_t ch : token) {
+    hash ^= static_cast<uint64_t>(ch);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+void FlatCounter::push_entry(uint64_t hash, count_type count) {
+  entries_.push_back(Entry{hash, count});
+  total_count_ += count;
+}
+
+FlatCounter FlatCounter::from_tokens(
+    const std::vector<Core::UnicodeString> &tokens, bool as_set) {
+  FlatCounter result;
+  if (tokens.empty()) {
+    return result;
+  }
+
+  // Fingerprint scratch comes from the per-thread arena; only the coalesced
+  // entries below outlive this call
+  Core::ArenaScope scratch;
+  Core::PoolVector<uint64_t> hashes(scratch.allocator<uint64_t>());
+  hashes.reserve(tokens.size());
+  for (const auto &token : tokens) {
+    hashes.push_back(fingerprint(token.unicode()));
+  }
+  std::sort(hashes.begin(), hashes.end());
+
+  // Coalesce runs of equal fingerprints into (hash, count) entries
+  result.entries_.reserve(hashes.size());
+  size_t i = 0;
+  while (i < hashes.size()) {
+    size_t run_start = i;
+    while (i < hashes.size() && hashes[i] == hashes[run_start]) {
+      ++i;
+    }
+    count_type count =
+        as_set ? 1 : static_cast<count_type>(i - run_start);
+    result.push_entry(hashes[run_start], count);
+  }
+
+  return result;
+}
+
+FlatCounter FlatCounter::from_sorted_entries(const uint64_t *hashes,
+                                             const count_type *counts,
+                                             size_t count, bool as_set) {
+  FlatCounter result;
+  result.entries_.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    result.push_entry(hashes[i], as_set ? 1 : counts[i]);
+  }
+  return result;
+}
+
+FlatCounter FlatCounter::intersect(const FlatCounter &other) const {
+  FlatCounter result;
+  result.entries_.reserve(std::min(entries_.size(), other.entries_.size()));
+
+  size_t i = 0, j = 0;
+  while (i < entries_.size() && j < other.entries_.size()) {
+    if (entries_[i].hash < other.entries_[j].hash) {
+      ++i;
+    } else if (other.entries_[j].hash < entries_[i].hash) {
+      ++j;
+    } else {
+      result.push_entry(entries_[i].hash,
+                        std::min(entries_[i].count, other.entries_[j].count));
+      ++i;
+      ++j;
+    }
+  }
+
+  return result;
+}
+
+FlatCounter FlatCounter::union_with(const FlatCounter &other) const {
+  FlatCounter result;
+  result.entries_.reserve(entries_.size() + other.entries_.size());
+
+  size_t i = 0, j = 0;
+  while (i < entries_.size() && j < other.entries_.size()) {
+    if (entries_[i].hash < other.entries_[j].hash) {
+      result.push_entry(entries_[i].hash, entries_[i].count);
+      ++i;
+    } else if (other.entries_[j].hash < entries_[i].hash) {
+      result.push_entry(other.entries_[j].hash, other.entries_[j].count);
+      ++j;
+    } else {
+      result.push_entry(entries_[i].hash,
+                        std::max(entries_[i].count, other.entries_[j].count));
+      ++i;
+      ++j;
+    }
+  }
+  for (; i < entries_.size(); ++i) {
+    result.push_entry(entries_[i].hash, entries_[i].count);
+  }
+  for (; j < other.entries_.size(); ++j) {
+    result.push_entry(other.entries_[j].hash, other.entries_[j].count);
+  }
+
+  return result;
+}
+
+FlatCounter FlatCounter::sum_with(const FlatCounter &other) const {
+  FlatCounter result;
+  result.entries_.reserve(entries_.size() + other.entries_.size());
+
+  size_t i = 0, j = 0;
+  while (i < entries_.size() && j < other.entries_.size()) {
+    if (entries_[i].hash < other.entries_[j].hash) {
+      result.push_entry(entries_[i].hash, entries_[i].count);
+      ++i;
+    } else if (other.entries_[j].hash < entries_[i].hash) {
+      result.push_entry(other.entries_[j].hash, other.entries_[j].count);
+      ++j;
+    } else {
+      result.push_entry(entries_[i].hash,
+                        entries_[i].count + other.entries_[j].count);
+      ++i;
+      ++j;
+    }
+  }
+  for (; i < entries_.size(); ++i) {
+    result.push_entry(entries_[i].hash, entries_[i].count);
+  }
+  for (; j < other.entries_.size(); ++j) {
+    result.push_entry(other.entries_[j].hash, other.entries_[j].count);
+  }
+
+  return result;
+}
+
 // JaccardAlgorithm Implementation
 
 Core::SimilarityResult JaccardAlgorithm::compute_similarity_impl(
@@ -13,34 +155,14 @@ Core::SimilarityResult JaccardAlgorithm::compute_similarity_impl(
     auto tokens1 = tokenize_string(s1, config);
     auto tokens2 = tokenize_string(s2, config);
 
-    // Convert to appropriate representation
-    if (config.preprocessing == Core::PreprocessingMode::Word) {
-      // For word-based comparison, use set-based Jaccard
-      std::unordered_set<std::u32string> set1, set2;
-
-      for (const auto &token : tokens1) {
-        set1.insert(token.unicode());
-      }
-      for (const auto &token : tokens2) {
-        set2.insert(token.unicode());
-      }
+    // Word mode compares distinct tokens; character/n-gram mode keeps
+    // multiplicities
+    bool as_set = (config.preprocessing == Core::PreprocessingMode::Word);
+    auto counter1 = FlatCounter::from_tokens(tokens1, as_set);
+    auto counter2 = FlatCounter::from_tokens(tokens2, as_set);
 
-      double similarity = compute_jaccard_set(set1, set2);
-      return Core::SimilarityResult{similarity};
-    } else {
-      // For character/n-gram based comparison, use multiset
-      Counter<std::u32string> counter1, counter2;
-
-      for (const auto &token : tokens1) {
-        counter1.increment(token.unicode());
-      }
-      for (const auto &token : tokens2) {
-        counter2.increment(token.unicode());
-      }
-
-      double similarity = compute_jaccard_multiset(counter1, counter2);
-      return Core::SimilarityResult{similarity};
-    }
+    double similarity = compute_jaccard_multiset(counter1, counter2);
+    return Core::SimilarityResult{similarity};
 
   } catch (const std::exception &e) {
     return Core::SimilarityResult{
@@ -64,6 +186,53 @@ Core::DistanceResult JaccardAlgorithm::compute_distance_impl(
   return Core::DistanceResult{int_distance};
 }
 
+std::shared_ptr<void> JaccardAlgorithm::prepare_query_state(
+    const Core::UnicodeString &processed_query,
+    const Core::AlgorithmConfig &config) const {
+  auto tokens = tokenize_string(processed_query, config);
+  bool as_set = (config.preprocessing == Core::PreprocessingMode::Word);
+  return std::make_shared<FlatCounter>(
+      FlatCounter::from_tokens(tokens, as_set));
+}
+
+Core::SimilarityResult JaccardAlgorithm::compute_similarity_prepared_impl(
+    const PreparedQuery &prepared,
+    const Core::UnicodeString &processed_candidate,
+    const Core::AlgorithmConfig &config) const {
+  try {
+    const auto &counter1 =
+        *static_cast<const FlatCounter *>(prepared.state.get());
+
+    // Only the candidate side is tokenized here; the query tokens were
+    // built once in prepare_query_state
+    auto tokens = tokenize_string(processed_candidate, config);
+    bool as_set = (config.preprocessing == Core::PreprocessingMode::Word);
+    auto counter2 = FlatCounter::from_tokens(tokens, as_set);
+
+    double similarity = compute_jaccard_multiset(counter1, counter2);
+    return Core::SimilarityResult{similarity};
+
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::ComputationOverflow, e.what()}};
+  }
+}
+
+Core::SimilarityResult JaccardAlgorithm::compute_similarity_profiles_impl(
+    const PreparedQuery &profile1, const PreparedQuery &profile2,
+    const Core::AlgorithmConfig &config) const {
+  if (!profile1.state || !profile2.state) {
+    return BaseAlgorithm::compute_similarity_profiles_impl(profile1, profile2,
+                                                           config);
+  }
+
+  const auto &counter1 =
+      *static_cast<const FlatCounter *>(profile1.state.get());
+  const auto &counter2 =
+      *static_cast<const FlatCounter *>(profile2.state.get());
+  return Core::SimilarityResult{compute_jaccard_multiset(counter1, counter2)};
+}
+
 double JaccardAlgorithm::compute_jaccard_similarity(
     const std::vector<Core::UnicodeString> &tokens1,
     const std::vector<Core::UnicodeString> &tokens2, bool as_set) const {
@@ -75,34 +244,13 @@ double JaccardAlgorithm::compute_jaccard_similarity(
     return 0.0;
   }
 
-  if (as_set) {
-    std::unordered_set<std::u32string> set1, set2;
-
-    for (const auto &token : tokens1) {
-      set1.insert(token.unicode());
-    }
-    for (const auto &token : tokens2) {
-      set2.insert(token.unicode());
-    }
-
-    return compute_jaccard_set(set1, set2);
-  } else {
-    Counter<std::u32string> counter1, counter2;
-
-    for (const auto &token : tokens1) {
-      counter1.increment(token.unicode());
-    }
-    for (const auto &token : tokens2) {
-      counter2.increment(token.unicode());
-    }
-
-    return compute_jaccard_multiset(counter1, counter2);
-  }
+  auto counter1 = FlatCounter::from_tokens(tokens1, as_set);
+  auto counter2 = FlatCounter::from_tokens(tokens2, as_set);
+  return compute_jaccard_multiset(counter1, counter2);
 }
 
 double JaccardAlgorithm::compute_jaccard_multiset(
-    const Counter<std::u32string> &counter1,
-    const Counter<std::u32string> &counter2) const {
+    const FlatCounter &counter1, const FlatCounter &counter2) const {
   if (counter1.empty() && counter2.empty()) {
     return 1.0;
   }
@@ -125,56 +273,14 @@ double JaccardAlgorithm::compute_jaccard_multiset(
          static_cast<double>(union_size);
 }
 
-double JaccardAlgorithm::compute_jaccard_set(
-    const std::unordered_set<std::u32string> &set1,
-    const std::unordered_set<std::u32string> &set2) const {
-  if (set1.empty() && set2.empty()) {
-    return 1.0;
-  }
-
-  if (set1.empty() || set2.empty()) {
-    return 0.0;
-  }
-
-  // Calculate intersection
-  size_t intersection_size = 0;
-  const auto &smaller_set = (set1.size() <= set2.size()) ? set1 : set2;
-  const auto &larger_set = (set1.size() <= set2.size()) ? set2 : set1;
-
-  for (const auto &item : smaller_set) {
-    if (larger_set.find(item) != larger_set.end()) {
-      ++intersection_size;
-    }
-  }
-
-  // Union size = size1 + size2 - intersection
-  size_t union_size = set1.size() + set2.size() - intersection_size;
-
-  if (union_size == 0) {
-    return 0.0;
-  }
-
-  return static_cast<double>(intersection_size) /
-         static_cast<double>(union_size);
-}
-
 // SorensenDiceAlgorithm Implementation
 
 Core::SimilarityResult SorensenDiceAlgorithm::compute_similarity_impl(
     const Core::UnicodeString &s1, const Core::UnicodeString &s2,
     const Core::AlgorithmConfig &config) const {
   try {
-    auto tokens1 = tokenize_string(s1, config);
-    auto tokens2 = tokenize_string(s2, config);
-
-    Counter<std::u32string> counter1, counter2;
-
-    for (const auto &token : tokens1) {
-      counter1.increment(token.unicode());
-    }
-    for (const auto &token : tokens2) {
-      counter2.increment(token.unicode());
-    }
+    auto counter1 = FlatCounter::from_tokens(tokenize_string(s1, config));
+    auto counter2 = FlatCounter::from_tokens(tokenize_string(s2, config));
 
     double similarity = compute_dice_similarity(counter1, counter2);
     return Core::SimilarityResult{similarity};
@@ -198,9 +304,50 @@ Core::DistanceResult SorensenDiceAlgorithm::compute_distance_impl(
   return Core::DistanceResult{int_distance};
 }
 
+std::shared_ptr<void> SorensenDiceAlgorithm::prepare_query_state(
+    const Core::UnicodeString &processed_query,
+    const Core::AlgorithmConfig &config) const {
+  return std::make_shared<FlatCounter>(
+      FlatCounter::from_tokens(tokenize_string(processed_query, config)));
+}
+
+Core::SimilarityResult SorensenDiceAlgorithm::compute_similarity_prepared_impl(
+    const PreparedQuery &prepared,
+    const Core::UnicodeString &processed_candidate,
+    const Core::AlgorithmConfig &config) const {
+  try {
+    const auto &counter1 =
+        *static_cast<const FlatCounter *>(prepared.state.get());
+
+    auto counter2 =
+        FlatCounter::from_tokens(tokenize_string(processed_candidate, config));
+
+    double similarity = compute_dice_similarity(counter1, counter2);
+    return Core::SimilarityResult{similarity};
+
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::ComputationOverflow, e.what()}};
+  }
+}
+
+Core::SimilarityResult SorensenDiceAlgorithm::compute_similarity_profiles_impl(
+    const PreparedQuery &profile1, const PreparedQuery &profile2,
+    const Core::AlgorithmConfig &config) const {
+  if (!profile1.state || !profile2.state) {
+    return BaseAlgorithm::compute_similarity_profiles_impl(profile1, profile2,
+                                                           config);
+  }
+
+  const auto &counter1 =
+      *static_cast<const FlatCounter *>(profile1.state.get());
+  const auto &counter2 =
+      *static_cast<const FlatCounter *>(profile2.state.get());
+  return Core::SimilarityResult{compute_dice_similarity(counter1, counter2)};
+}
+
 double SorensenDiceAlgorithm::compute_dice_similarity(
-    const Counter<std::u32string> &counter1,
-    const Counter<std::u32string> &counter2) const {
+    const FlatCounter &counter1, const FlatCounter &counter2) const {
   if (counter1.empty() && counter2.empty()) {
     return 1.0;
   }
@@ -227,17 +374,8 @@ Core::SimilarityResult OverlapAlgorithm::compute_similarity_impl(
     const Core::UnicodeString &s1, const Core::UnicodeString &s2,
     const Core::AlgorithmConfig &config) const {
   try {
-    auto tokens1 = tokenize_string(s1, config);
-    auto tokens2 = tokenize_string(s2, config);
-
-    Counter<std::u32string> counter1, counter2;
-
-    for (const auto &token : tokens1) {
-      counter1.increment(token.unicode());
-    }
-    for (const auto &token : tokens2) {
-      counter2.increment(token.unicode());
-    }
+    auto counter1 = FlatCounter::from_tokens(tokenize_string(s1, config));
+    auto counter2 = FlatCounter::from_tokens(tokenize_string(s2, config));
 
     double similarity = compute_overlap_similarity(counter1, counter2);
     return Core::SimilarityResult{similarity};
@@ -261,9 +399,50 @@ Core::DistanceResult OverlapAlgorithm::compute_distance_impl(
   return Core::DistanceResult{int_distance};
 }
 
+std::shared_ptr<void> OverlapAlgorithm::prepare_query_state(
+    const Core::UnicodeString &processed_query,
+    const Core::AlgorithmConfig &config) const {
+  return std::make_shared<FlatCounter>(
+      FlatCounter::from_tokens(tokenize_string(processed_query, config)));
+}
+
+Core::SimilarityResult OverlapAlgorithm::compute_similarity_prepared_impl(
+    const PreparedQuery &prepared,
+    const Core::UnicodeString &processed_candidate,
+    const Core::AlgorithmConfig &config) const {
+  try {
+    const auto &counter1 =
+        *static_cast<const FlatCounter *>(prepared.state.get());
+
+    auto counter2 =
+        FlatCounter::from_tokens(tokenize_string(processed_candidate, config));
+
+    double similarity = compute_overlap_similarity(counter1, counter2);
+    return Core::SimilarityResult{similarity};
+
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::ComputationOverflow, e.what()}};
+  }
+}
+
+Core::SimilarityResult OverlapAlgorithm::compute_similarity_profiles_impl(
+    const PreparedQuery &profile1, const PreparedQuery &profile2,
+    const Core::AlgorithmConfig &config) const {
+  if (!profile1.state || !profile2.state) {
+    return BaseAlgorithm::compute_similarity_profiles_impl(profile1, profile2,
+                                                           config);
+  }
+
+  const auto &counter1 =
+      *static_cast<const FlatCounter *>(profile1.state.get());
+  const auto &counter2 =
+      *static_cast<const FlatCounter *>(profile2.state.get());
+  return Core::SimilarityResult{compute_overlap_similarity(counter1, counter2)};
+}
+
 double OverlapAlgorithm::compute_overlap_similarity(
-    const Counter<std::u32string> &counter1,
-    const Counter<std::u32string> &counter2) const {
+    const FlatCounter &counter1, const FlatCounter &counter2) const {
   if (counter1.empty() && counter2.empty()) {
     return 1.0;
   }
@@ -295,17 +474,8 @@ Core::SimilarityResult TverskyAlgorithm::compute_similarity_impl(
   }
 
   try {
-    auto tokens1 = tokenize_string(s1, config);
-    auto tokens2 = tokenize_string(s2, config);
-
-    Counter<std::u32string> counter1, counter2;
-
-    for (const auto &token : tokens1) {
-      counter1.increment(token.unicode());
-    }
-    for (const auto &token : tokens2) {
-      counter2.increment(token.unicode());
-    }
+    auto counter1 = FlatCounter::from_tokens(tokenize_string(s1, config));
+    auto counter2 = FlatCounter::from_tokens(tokenize_string(s2, config));
 
     double similarity = compute_tversky_similarity(counter1, counter2,
                                                    *config.alpha, *config.beta);
@@ -330,9 +500,65 @@ Core::DistanceResult TverskyAlgorithm::compute_distance_impl(
   return Core::DistanceResult{int_distance};
 }
 
+std::shared_ptr<void> TverskyAlgorithm::prepare_query_state(
+    const Core::UnicodeString &processed_query,
+    const Core::AlgorithmConfig &config) const {
+  return std::make_shared<FlatCounter>(
+      FlatCounter::from_tokens(tokenize_string(processed_query, config)));
+}
+
+Core::SimilarityResult TverskyAlgorithm::compute_similarity_prepared_impl(
+    const PreparedQuery &prepared,
+    const Core::UnicodeString &processed_candidate,
+    const Core::AlgorithmConfig &config) const {
+  if (!config.alpha.has_value() || !config.beta.has_value()) {
+    return Core::SimilarityResult{Core::SimilarityError{
+        Core::ErrorCode::InvalidConfiguration,
+        "Tversky algorithm requires alpha and beta parameters"}};
+  }
+
+  try {
+    const auto &counter1 =
+        *static_cast<const FlatCounter *>(prepared.state.get());
+
+    auto counter2 =
+        FlatCounter::from_tokens(tokenize_string(processed_candidate, config));
+
+    double similarity = compute_tversky_similarity(counter1, counter2,
+                                                   *config.alpha, *config.beta);
+    return Core::SimilarityResult{similarity};
+
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::ComputationOverflow, e.what()}};
+  }
+}
+
+Core::SimilarityResult TverskyAlgorithm::compute_similarity_profiles_impl(
+    const PreparedQuery &profile1, const PreparedQuery &profile2,
+    const Core::AlgorithmConfig &config) const {
+  if (!config.alpha.has_value() || !config.beta.has_value()) {
+    return Core::SimilarityResult{Core::SimilarityError{
+        Core::ErrorCode::InvalidConfiguration,
+        "Tversky algorithm requires alpha and beta parameters"}};
+  }
+
+  if (!profile1.state || !profile2.state) {
+    return BaseAlgorithm::compute_similarity_profiles_impl(profile1, profile2,
+                                                           config);
+  }
+
+  const auto &counter1 =
+      *static_cast<const FlatCounter *>(profile1.state.get());
+  const auto &counter2 =
+      *static_cast<const FlatCounter *>(profile2.state.get());
+  return Core::SimilarityResult{compute_tversky_similarity(
+      counter1, counter2, *config.alpha, *config.beta)};
+}
+
 double TverskyAlgorithm::compute_tversky_similarity(
-    const Counter<std::u32string> &counter1,
-    const Counter<std::u32string> &counter2, double alpha, double beta) const {
+    const FlatCounter &counter1, const FlatCounter &counter2, double alpha,
+    double beta) const {
   if (counter1.empty() && counter2.empty()) {
     return 1.0;
   }
@@ -359,4 +585,4 @@ double TverskyAlgorithm::compute_tversky_similarity(
   return static_cast<double>(intersection_size) / denominator;
 }
 
-} // namespace TextSimilarity::Algorithms
\ No newline at end of file
+} // namespace TextSimilarity::Algorithms
@@ -2,84 +2,68 @@
 
 #include "base_algorithm.hpp"
 #include <cmath>
-#include <unordered_map>
-#include <unordered_set>
+#include <cstdint>
 #include <vector>
 
 namespace TextSimilarity::Algorithms {
 
-// Counter-based frequency map for token operations
-template <typename T> class Counter {
+// Token multiset stored as a flat vector of (fingerprint, count) pairs
+// sorted by fingerprint. Each token is reduced to a 64-bit hash of its
+// code points, so set operations are linear merge-joins over contiguous
+// memory instead of hash lookups on heap-allocated n-gram strings.
+// Distinct tokens colliding on the same fingerprint are conflated; at
+// 64 bits that is negligible next to the scores' own granularity.
+class FlatCounter {
 public:
-  using value_type = T;
   using count_type = uint32_t;
-  using map_type = std::unordered_map<T, count_type>;
 
-  Counter() = default;
+  struct Entry {
+    uint64_t hash;
+    count_type count;
+  };
 
-  template <typename Iterator> Counter(Iterator begin, Iterator end) {
-    for (auto it = begin; it != end; ++it) {
-      increment(*it);
-    }
-  }
-
-  explicit Counter(const std::vector<T> &items)
-      : Counter(items.begin(), items.end()) {}
+  FlatCounter() = default;
 
-  void increment(const T &item, count_type count = 1) {
-    counts_[item] += count;
-  }
+  // Builds the sorted counter from tokenizer output. When as_set is true
+  // duplicate tokens collapse to a count of one (set semantics, used for
+  // word-mode Jaccard).
+  [[nodiscard]] static FlatCounter
+  from_tokens(const std::vector<Core::UnicodeString> &tokens,
+              bool as_set = false);
 
-  [[nodiscard]] count_type get_count(const T &item) const {
-    auto it = counts_.find(item);
-    return (it != counts_.end()) ? it->second : 0;
-  }
+  // Rebuilds a counter from fingerprints already sorted by hash (corpus
+  // index load path). No hashing or tokenization happens here.
+  [[nodiscard]] static FlatCounter
+  from_sorted_entries(const uint64_t *hashes, const count_type *counts,
+                      size_t count, bool as_set = false);
 
-  [[nodiscard]] size_t size() const noexcept { return counts_.size(); }
-  [[nodiscard]] bool empty() const noexcept { return counts_.empty(); }
+  [[nodiscard]] size_t size() const noexcept { return entries_.size(); }
+  [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
 
+  // Sum of all counts (multiset cardinality), maintained on construction
   [[nodiscard]] count_type total_count() const noexcept {
-    count_type total = 0;
-    for (const auto &pair : counts_) {
-      total += pair.second;
-    }
-    return total;
+    return total_count_;
   }
 
-  // Set operations
-  Counter intersect(const Counter &other) const {
-    Counter result;
-    for (const auto &[item, count] : counts_) {
-      count_type other_count = other.get_count(item);
-      if (other_count > 0) {
-        result.counts_[item] = std::min(count, other_count);
-      }
-    }
-    return result;
+  // Entries sorted by fingerprint (corpus index serialization)
+  [[nodiscard]] const std::vector<Entry> &entries() const noexcept {
+    return entries_;
   }
 
-  Counter union_with(const Counter &other) const {
-    Counter result = *this;
-    for (const auto &[item, count] : other.counts_) {
-      result.counts_[item] = std::max(result.get_count(item), count);
-    }
-    return result;
-  }
+  // Merge-join set operations; both operands are sorted by fingerprint,
+  // so each runs in O(size() + other.size()) with sequential access
+  [[nodiscard]] FlatCounter intersect(const FlatCounter &other) const;
+  [[nodiscard]] FlatCounter union_with(const FlatCounter &other) const;
+  [[nodiscard]] FlatCounter sum_with(const FlatCounter &other) const;
 
-  Counter sum_with(const Counter &other) const {
-    Counter result = *this;
-    for (const auto &[item, count] : other.counts_) {
-      result.counts_[item] += count;
-    }
-    return result;
-  }
+private:
+  std::vector<Entry> entries_;
+  count_type total_count_{0};
 
-  // Iterator support
-  auto begin() const { return counts_.begin(); }
-  auto end() const { return counts_.end(); }
+  [[nodiscard]] static uint64_t
+  fingerprint(const std::u32string &token) noexcept;
 
-private:
-  map_type counts_;
+  void push_entry(uint64_t hash, count_type count);
 };
 
 // Jaccard similarity implementation
@@ -115,19 +99,30 @@ protected:
   bool is_symmetric_impl() const noexcept override { return true; }
   bool is_metric_impl() const noexcept override { return true; }
 
+  [[nodiscard]] std::shared_ptr<void>
+  prepare_query_state(const Core::UnicodeString &processed_query,
+                      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_prepared_impl(
+      const PreparedQuery &prepared,
+      const Core::UnicodeString &processed_candidate,
+      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_profiles_impl(
+      const PreparedQuery &profile1, const PreparedQuery &profile2,
+      const Core::AlgorithmConfig &config) const override;
+
 private:
   [[nodiscard]] double
   compute_jaccard_similarity(const std::vector<Core::UnicodeString> &tokens1,
                              const std::vector<Core::UnicodeString> &tokens2,
                              bool as_set = false) const;
 
+  // Set semantics (word mode) are the multiset formula over counters
+  // built with as_set, so one merge-join path serves both
   [[nodiscard]] double
-  compute_jaccard_multiset(const Counter<std::u32string> &counter1,
-                           const Counter<std::u32string> &counter2) const;
-
-  [[nodiscard]] double
-  compute_jaccard_set(const std::unordered_set<std::u32string> &set1,
-                      const std::unordered_set<std::u32string> &set2) const;
+  compute_jaccard_multiset(const FlatCounter &counter1,
+                           const FlatCounter &counter2) const;
 };
 
 // Sorensen-Dice similarity
@@ -162,10 +157,23 @@ protected:
 
   bool is_symmetric_impl() const noexcept override { return true; }
 
+  [[nodiscard]] std::shared_ptr<void>
+  prepare_query_state(const Core::UnicodeString &processed_query,
+                      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_prepared_impl(
+      const PreparedQuery &prepared,
+      const Core::UnicodeString &processed_candidate,
+      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_profiles_impl(
+      const PreparedQuery &profile1, const PreparedQuery &profile2,
+      const Core::AlgorithmConfig &config) const override;
+
 private:
   [[nodiscard]] double
-  compute_dice_similarity(const Counter<std::u32string> &counter1,
-                          const Counter<std::u32string> &counter2) const;
+  compute_dice_similarity(const FlatCounter &counter1,
+                          const FlatCounter &counter2) const;
 };
 
 // Overlap coefficient
@@ -200,10 +208,23 @@ protected:
 
   bool is_symmetric_impl() const noexcept override { return true; }
 
+  [[nodiscard]] std::shared_ptr<void>
+  prepare_query_state(const Core::UnicodeString &processed_query,
+                      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_prepared_impl(
+      const PreparedQuery &prepared,
+      const Core::UnicodeString &processed_candidate,
+      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_profiles_impl(
+      const PreparedQuery &profile1, const PreparedQuery &profile2,
+      const Core::AlgorithmConfig &config) const override;
+
 private:
   [[nodiscard]] double
-  compute_overlap_similarity(const Counter<std::u32string> &counter1,
-                             const Counter<std::u32string> &counter2) const;
+  compute_overlap_similarity(const FlatCounter &counter1,
+                             const FlatCounter &counter2) const;
 };
 
 // Tversky index (generalized Jaccard)
@@ -239,11 +260,24 @@ protected:
   // Tversky is not symmetric unless alpha == beta
   bool is_symmetric_impl() const noexcept override { return false; }
 
+  [[nodiscard]] std::shared_ptr<void>
+  prepare_query_state(const Core::UnicodeString &processed_query,
+                      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_prepared_impl(
+      const PreparedQuery &prepared,
+      const Core::UnicodeString &processed_candidate,
+      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_profiles_impl(
+      const PreparedQuery &profile1, const PreparedQuery &profile2,
+      const Core::AlgorithmConfig &config) const override;
+
 private:
   [[nodiscard]] double
-  compute_tversky_similarity(const Counter<std::u32string> &counter1,
-                             const Counter<std::u32string> &counter2,
-                             double alpha, double beta) const;
+  compute_tversky_similarity(const FlatCounter &counter1,
+                             const FlatCounter &counter2, double alpha,
+                             double beta) const;
 };
 
 } // namespace TextSimilarity::Algorithms
\ No newline at end of file
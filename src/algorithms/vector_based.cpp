@@ -1,4 +1,5 @@
 #include "vector_based.hpp"
+#include "../core/memory_pool.hpp"
 #include <algorithm>
 #include <array>
 #include <unordered_map>
@@ -13,11 +14,6 @@
 namespace TextSimilarity::Algorithms {
 
 namespace {
-// Helper to check if string is ASCII
-bool is_ascii_char(char c) noexcept {
-  return static_cast<unsigned char>(c) < 128;
-}
-
 // Fast character frequency counting for ASCII strings
 std::array<uint32_t, 256> count_ascii_frequencies(const std::string &str) {
   std::array<uint32_t, 256> counts{};
@@ -26,6 +22,148 @@ std::array<uint32_t, 256> count_ascii_frequencies(const std::string &str) {
   }
   return counts;
 }
+
+// Maps both documents' terms into one shared id space: each union term gets
+// one position in two aligned contiguous count arrays, so the kernels below
+// stream over memory instead of chasing hash buckets per term. Ids are
+// implicit array positions; the map lookups happen once here, not once per
+// arithmetic operation.
+void build_dense_pair(const FrequencyVector<std::u32string> &v1,
+                      const FrequencyVector<std::u32string> &v2,
+                      Core::PoolVector<uint32_t> &counts1,
+                      Core::PoolVector<uint32_t> &counts2) {
+  counts1.reserve(v1.size() + v2.size());
+  counts2.reserve(v1.size() + v2.size());
+
+  for (const auto &[term, freq] : v1) {
+    counts1.push_back(freq);
+    counts2.push_back(v2.get_frequency(term));
+  }
+  for (const auto &[term, freq] : v2) {
+    if (v1.get_frequency(term) == 0) {
+      counts1.push_back(0);
+      counts2.push_back(freq);
+    }
+  }
+}
+
+// Streaming kernels over the aligned count arrays. The AVX2 paths process
+// eight counts per iteration and accumulate in double precision; counts are
+// integers, so the reassociated sums are bit-identical to the scalar loops.
+
+#ifdef __x86_64__
+double horizontal_sum_pd(__m256d v) noexcept {
+  double lanes[4];
+  _mm256_storeu_pd(lanes, v);
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+#endif
+
+double dense_dot(const uint32_t *a, const uint32_t *b, size_t count) noexcept {
+  size_t i = 0;
+  double result = 0.0;
+
+#ifdef __x86_64__
+  __m256d acc = _mm256_setzero_pd();
+  for (; i + 8 <= count; i += 8) {
+    __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+    __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+    __m256d a_lo = _mm256_cvtepi32_pd(_mm256_extracti128_si256(va, 0));
+    __m256d a_hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(va, 1));
+    __m256d b_lo = _mm256_cvtepi32_pd(_mm256_extracti128_si256(vb, 0));
+    __m256d b_hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(vb, 1));
+    acc = _mm256_add_pd(acc, _mm256_mul_pd(a_lo, b_lo));
+    acc = _mm256_add_pd(acc, _mm256_mul_pd(a_hi, b_hi));
+  }
+  result = horizontal_sum_pd(acc);
+#endif
+
+  for (; i < count; ++i) {
+    result += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+  }
+  return result;
+}
+
+double dense_l2_squared(const uint32_t *a, const uint32_t *b,
+                        size_t count) noexcept {
+  size_t i = 0;
+  double result = 0.0;
+
+#ifdef __x86_64__
+  __m256d acc = _mm256_setzero_pd();
+  for (; i + 8 <= count; i += 8) {
+    __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+    __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+    __m256d a_lo = _mm256_cvtepi32_pd(_mm256_extracti128_si256(va, 0));
+    __m256d a_hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(va, 1));
+    __m256d b_lo = _mm256_cvtepi32_pd(_mm256_extracti128_si256(vb, 0));
+    __m256d b_hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(vb, 1));
+    __m256d d_lo = _mm256_sub_pd(a_lo, b_lo);
+    __m256d d_hi = _mm256_sub_pd(a_hi, b_hi);
+    acc = _mm256_add_pd(acc, _mm256_mul_pd(d_lo, d_lo));
+    acc = _mm256_add_pd(acc, _mm256_mul_pd(d_hi, d_hi));
+  }
+  result = horizontal_sum_pd(acc);
+#endif
+
+  for (; i < count; ++i) {
+    const double diff = static_cast<double>(a[i]) - static_cast<double>(b[i]);
+    result += diff * diff;
+  }
+  return result;
+}
+
+double dense_l1(const uint32_t *a, const uint32_t *b, size_t count) noexcept {
+  size_t i = 0;
+  double result = 0.0;
+
+#ifdef __x86_64__
+  __m256d acc = _mm256_setzero_pd();
+  for (; i + 8 <= count; i += 8) {
+    __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+    __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+    // Unsigned absolute difference stays in the integer domain
+    __m256i diff = _mm256_sub_epi32(_mm256_max_epu32(va, vb),
+                                    _mm256_min_epu32(va, vb));
+    __m256d d_lo = _mm256_cvtepi32_pd(_mm256_extracti128_si256(diff, 0));
+    __m256d d_hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(diff, 1));
+    acc = _mm256_add_pd(acc, _mm256_add_pd(d_lo, d_hi));
+  }
+  result = horizontal_sum_pd(acc);
+#endif
+
+  for (; i < count; ++i) {
+    result += std::abs(static_cast<double>(a[i]) - static_cast<double>(b[i]));
+  }
+  return result;
+}
+
+double dense_linf(const uint32_t *a, const uint32_t *b, size_t count) noexcept {
+  size_t i = 0;
+  uint32_t max_diff = 0;
+
+#ifdef __x86_64__
+  __m256i vmax = _mm256_setzero_si256();
+  for (; i + 8 <= count; i += 8) {
+    __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+    __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+    __m256i diff = _mm256_sub_epi32(_mm256_max_epu32(va, vb),
+                                    _mm256_min_epu32(va, vb));
+    vmax = _mm256_max_epu32(vmax, diff);
+  }
+  uint32_t lanes[8];
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), vmax);
+  for (uint32_t lane : lanes) {
+    max_diff = std::max(max_diff, lane);
+  }
+#endif
+
+  for (; i < count; ++i) {
+    const uint32_t diff = (a[i] > b[i]) ? a[i] - b[i] : b[i] - a[i];
+    max_diff = std::max(max_diff, diff);
+  }
+  return static_cast<double>(max_diff);
+}
 } // namespace
 
 // CosineAlgorithm Implementation
@@ -37,7 +175,7 @@ Core::SimilarityResult CosineAlgorithm::compute_similarity_impl(
     // Special case: character vectorization mode for performance
     if (config.preprocessing == Core::PreprocessingMode::Character) {
       // Use optimized character vectorization
-      if (is_ascii_string(s1.utf8()) && is_ascii_string(s2.utf8())) {
+      if (s1.is_ascii() && s2.is_ascii()) {
         double similarity = compute_cosine_simd(s1.utf8(), s2.utf8(), config);
         return Core::SimilarityResult{similarity};
       } else {
@@ -83,6 +221,66 @@ Core::DistanceResult CosineAlgorithm::compute_distance_impl(
   return Core::DistanceResult{int_distance};
 }
 
+std::shared_ptr<void> CosineAlgorithm::prepare_query_state(
+    const Core::UnicodeString &processed_query,
+    const Core::AlgorithmConfig &config) const {
+  // The character vectorization paths rebuild their per-pair state cheaply;
+  // only the token-based path benefits from a precomputed frequency vector
+  if (config.preprocessing == Core::PreprocessingMode::Character) {
+    return nullptr;
+  }
+
+  auto vector = std::make_shared<FrequencyVector<std::u32string>>();
+  for (const auto &token : tokenize_string(processed_query, config)) {
+    vector->increment(token.unicode());
+  }
+  // Populate the cached norm before the vector is shared across threads
+  (void)vector->magnitude();
+  return vector;
+}
+
+Core::SimilarityResult CosineAlgorithm::compute_similarity_prepared_impl(
+    const PreparedQuery &prepared,
+    const Core::UnicodeString &processed_candidate,
+    const Core::AlgorithmConfig &config) const {
+  if (!prepared.state) {
+    return compute_similarity_impl(prepared.processed, processed_candidate,
+                                   config);
+  }
+
+  try {
+    const auto &vector1 = *static_cast<const FrequencyVector<std::u32string> *>(
+        prepared.state.get());
+
+    FrequencyVector<std::u32string> vector2;
+    for (const auto &token : tokenize_string(processed_candidate, config)) {
+      vector2.increment(token.unicode());
+    }
+
+    double similarity = compute_cosine_similarity(vector1, vector2);
+    return Core::SimilarityResult{similarity};
+
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::ComputationOverflow, e.what()}};
+  }
+}
+
+Core::SimilarityResult CosineAlgorithm::compute_similarity_profiles_impl(
+    const PreparedQuery &profile1, const PreparedQuery &profile2,
+    const Core::AlgorithmConfig &config) const {
+  if (!profile1.state || !profile2.state) {
+    return BaseAlgorithm::compute_similarity_profiles_impl(profile1, profile2,
+                                                           config);
+  }
+
+  const auto &vector1 = *static_cast<const FrequencyVector<std::u32string> *>(
+      profile1.state.get());
+  const auto &vector2 = *static_cast<const FrequencyVector<std::u32string> *>(
+      profile2.state.get());
+  return Core::SimilarityResult{compute_cosine_similarity(vector1, vector2)};
+}
+
 double CosineAlgorithm::compute_cosine_similarity(
     const FrequencyVector<std::u32string> &vector1,
     const FrequencyVector<std::u32string> &vector2) const {
@@ -108,14 +306,21 @@ double CosineAlgorithm::compute_cosine_similarity(
     }
   }
 
-  double magnitude1 = vector1.magnitude();
-  double magnitude2 = vector2.magnitude();
-
+  // Cached on the vectors, so prepared queries and profiles never pay the
+  // norm pass twice
+  const double magnitude1 = vector1.magnitude();
+  const double magnitude2 = vector2.magnitude();
   if (magnitude1 == 0.0 || magnitude2 == 0.0) {
     return 0.0;
   }
 
-  double dot_product = vector1.dot_product(vector2);
+  Core::ArenaScope scratch;
+  Core::PoolVector<uint32_t> counts1(scratch.allocator<uint32_t>());
+  Core::PoolVector<uint32_t> counts2(scratch.allocator<uint32_t>());
+  build_dense_pair(vector1, vector2, counts1, counts2);
+
+  double dot_product = dense_dot(counts1.data(), counts2.data(),
+                                 counts1.size());
   double similarity = dot_product / (magnitude1 * magnitude2);
 
   // Clamp to [0, 1] to handle floating point precision issues
@@ -251,10 +456,6 @@ double CosineAlgorithm::compute_cosine_simd(
   return std::max(0.0, std::min(1.0, dot_product / denominator));
 }
 
-bool CosineAlgorithm::is_ascii_string(const std::string &str) const noexcept {
-  return std::all_of(str.begin(), str.end(), is_ascii_char);
-}
-
 // EuclideanAlgorithm Implementation
 
 Core::SimilarityResult EuclideanAlgorithm::compute_similarity_impl(
@@ -297,23 +498,74 @@ Core::DistanceResult EuclideanAlgorithm::compute_distance_impl(
   }
 }
 
-double EuclideanAlgorithm::compute_euclidean_distance(
-    const FrequencyVector<std::u32string> &vector1,
-    const FrequencyVector<std::u32string> &vector2) const {
-  // Get union of all terms
-  auto all_terms =
-      FrequencyVector<std::u32string>::get_union_terms(vector1, vector2);
+std::shared_ptr<void> EuclideanAlgorithm::prepare_query_state(
+    const Core::UnicodeString &processed_query,
+    const Core::AlgorithmConfig &config) const {
+  auto vector = std::make_shared<FrequencyVector<std::u32string>>();
+  for (const auto &token : tokenize_string(processed_query, config)) {
+    vector->increment(token.unicode());
+  }
+  return vector;
+}
 
-  double sum_squared_differences = 0.0;
+Core::SimilarityResult EuclideanAlgorithm::compute_similarity_prepared_impl(
+    const PreparedQuery &prepared,
+    const Core::UnicodeString &processed_candidate,
+    const Core::AlgorithmConfig &config) const {
+  try {
+    const auto &vector1 = *static_cast<const FrequencyVector<std::u32string> *>(
+        prepared.state.get());
 
-  for (const auto &term : all_terms) {
-    double freq1 = static_cast<double>(vector1.get_frequency(term));
-    double freq2 = static_cast<double>(vector2.get_frequency(term));
-    double difference = freq1 - freq2;
-    sum_squared_differences += difference * difference;
+    FrequencyVector<std::u32string> vector2;
+    for (const auto &token : tokenize_string(processed_candidate, config)) {
+      vector2.increment(token.unicode());
+    }
+
+    // Apply the same integer quantization as the distance path so results
+    // are identical to the pairwise API
+    double distance = compute_euclidean_distance(vector1, vector2);
+    uint32_t int_distance =
+        static_cast<uint32_t>(std::round(distance * 1000.0));
+    double similarity =
+        distance_to_similarity(static_cast<double>(int_distance) / 1000.0);
+    return Core::SimilarityResult{similarity};
+
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::ComputationOverflow, e.what()}};
+  }
+}
+
+Core::SimilarityResult EuclideanAlgorithm::compute_similarity_profiles_impl(
+    const PreparedQuery &profile1, const PreparedQuery &profile2,
+    const Core::AlgorithmConfig &config) const {
+  if (!profile1.state || !profile2.state) {
+    return BaseAlgorithm::compute_similarity_profiles_impl(profile1, profile2,
+                                                           config);
   }
 
-  return std::sqrt(sum_squared_differences);
+  const auto &vector1 = *static_cast<const FrequencyVector<std::u32string> *>(
+      profile1.state.get());
+  const auto &vector2 = *static_cast<const FrequencyVector<std::u32string> *>(
+      profile2.state.get());
+
+  double distance = compute_euclidean_distance(vector1, vector2);
+  uint32_t int_distance = static_cast<uint32_t>(std::round(distance * 1000.0));
+  double similarity =
+      distance_to_similarity(static_cast<double>(int_distance) / 1000.0);
+  return Core::SimilarityResult{similarity};
+}
+
+double EuclideanAlgorithm::compute_euclidean_distance(
+    const FrequencyVector<std::u32string> &vector1,
+    const FrequencyVector<std::u32string> &vector2) const {
+  Core::ArenaScope scratch;
+  Core::PoolVector<uint32_t> counts1(scratch.allocator<uint32_t>());
+  Core::PoolVector<uint32_t> counts2(scratch.allocator<uint32_t>());
+  build_dense_pair(vector1, vector2, counts1, counts2);
+
+  return std::sqrt(
+      dense_l2_squared(counts1.data(), counts2.data(), counts1.size()));
 }
 
 double
@@ -364,21 +616,71 @@ Core::DistanceResult ManhattanAlgorithm::compute_distance_impl(
   }
 }
 
-double ManhattanAlgorithm::compute_manhattan_distance(
-    const FrequencyVector<std::u32string> &vector1,
-    const FrequencyVector<std::u32string> &vector2) const {
-  auto all_terms =
-      FrequencyVector<std::u32string>::get_union_terms(vector1, vector2);
+std::shared_ptr<void> ManhattanAlgorithm::prepare_query_state(
+    const Core::UnicodeString &processed_query,
+    const Core::AlgorithmConfig &config) const {
+  auto vector = std::make_shared<FrequencyVector<std::u32string>>();
+  for (const auto &token : tokenize_string(processed_query, config)) {
+    vector->increment(token.unicode());
+  }
+  return vector;
+}
 
-  double sum_absolute_differences = 0.0;
+Core::SimilarityResult ManhattanAlgorithm::compute_similarity_prepared_impl(
+    const PreparedQuery &prepared,
+    const Core::UnicodeString &processed_candidate,
+    const Core::AlgorithmConfig &config) const {
+  try {
+    const auto &vector1 = *static_cast<const FrequencyVector<std::u32string> *>(
+        prepared.state.get());
+
+    FrequencyVector<std::u32string> vector2;
+    for (const auto &token : tokenize_string(processed_candidate, config)) {
+      vector2.increment(token.unicode());
+    }
+
+    double distance = compute_manhattan_distance(vector1, vector2);
+    uint32_t int_distance =
+        static_cast<uint32_t>(std::round(distance * 1000.0));
+    double similarity =
+        distance_to_similarity(static_cast<double>(int_distance) / 1000.0);
+    return Core::SimilarityResult{similarity};
+
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::ComputationOverflow, e.what()}};
+  }
+}
 
-  for (const auto &term : all_terms) {
-    double freq1 = static_cast<double>(vector1.get_frequency(term));
-    double freq2 = static_cast<double>(vector2.get_frequency(term));
-    sum_absolute_differences += std::abs(freq1 - freq2);
+Core::SimilarityResult ManhattanAlgorithm::compute_similarity_profiles_impl(
+    const PreparedQuery &profile1, const PreparedQuery &profile2,
+    const Core::AlgorithmConfig &config) const {
+  if (!profile1.state || !profile2.state) {
+    return BaseAlgorithm::compute_similarity_profiles_impl(profile1, profile2,
+                                                           config);
   }
 
-  return sum_absolute_differences;
+  const auto &vector1 = *static_cast<const FrequencyVector<std::u32string> *>(
+      profile1.state.get());
+  const auto &vector2 = *static_cast<const FrequencyVector<std::u32string> *>(
+      profile2.state.get());
+
+  double distance = compute_manhattan_distance(vector1, vector2);
+  uint32_t int_distance = static_cast<uint32_t>(std::round(distance * 1000.0));
+  double similarity =
+      distance_to_similarity(static_cast<double>(int_distance) / 1000.0);
+  return Core::SimilarityResult{similarity};
+}
+
+double ManhattanAlgorithm::compute_manhattan_distance(
+    const FrequencyVector<std::u32string> &vector1,
+    const FrequencyVector<std::u32string> &vector2) const {
+  Core::ArenaScope scratch;
+  Core::PoolVector<uint32_t> counts1(scratch.allocator<uint32_t>());
+  Core::PoolVector<uint32_t> counts2(scratch.allocator<uint32_t>());
+  build_dense_pair(vector1, vector2, counts1, counts2);
+
+  return dense_l1(counts1.data(), counts2.data(), counts1.size());
 }
 
 double
@@ -428,22 +730,71 @@ Core::DistanceResult ChebyshevAlgorithm::compute_distance_impl(
   }
 }
 
-double ChebyshevAlgorithm::compute_chebyshev_distance(
-    const FrequencyVector<std::u32string> &vector1,
-    const FrequencyVector<std::u32string> &vector2) const {
-  auto all_terms =
-      FrequencyVector<std::u32string>::get_union_terms(vector1, vector2);
+std::shared_ptr<void> ChebyshevAlgorithm::prepare_query_state(
+    const Core::UnicodeString &processed_query,
+    const Core::AlgorithmConfig &config) const {
+  auto vector = std::make_shared<FrequencyVector<std::u32string>>();
+  for (const auto &token : tokenize_string(processed_query, config)) {
+    vector->increment(token.unicode());
+  }
+  return vector;
+}
 
-  double max_difference = 0.0;
+Core::SimilarityResult ChebyshevAlgorithm::compute_similarity_prepared_impl(
+    const PreparedQuery &prepared,
+    const Core::UnicodeString &processed_candidate,
+    const Core::AlgorithmConfig &config) const {
+  try {
+    const auto &vector1 = *static_cast<const FrequencyVector<std::u32string> *>(
+        prepared.state.get());
+
+    FrequencyVector<std::u32string> vector2;
+    for (const auto &token : tokenize_string(processed_candidate, config)) {
+      vector2.increment(token.unicode());
+    }
 
-  for (const auto &term : all_terms) {
-    double freq1 = static_cast<double>(vector1.get_frequency(term));
-    double freq2 = static_cast<double>(vector2.get_frequency(term));
-    double difference = std::abs(freq1 - freq2);
-    max_difference = std::max(max_difference, difference);
+    double distance = compute_chebyshev_distance(vector1, vector2);
+    uint32_t int_distance =
+        static_cast<uint32_t>(std::round(distance * 1000.0));
+    double similarity =
+        distance_to_similarity(static_cast<double>(int_distance) / 1000.0);
+    return Core::SimilarityResult{similarity};
+
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::ComputationOverflow, e.what()}};
   }
+}
+
+Core::SimilarityResult ChebyshevAlgorithm::compute_similarity_profiles_impl(
+    const PreparedQuery &profile1, const PreparedQuery &profile2,
+    const Core::AlgorithmConfig &config) const {
+  if (!profile1.state || !profile2.state) {
+    return BaseAlgorithm::compute_similarity_profiles_impl(profile1, profile2,
+                                                           config);
+  }
+
+  const auto &vector1 = *static_cast<const FrequencyVector<std::u32string> *>(
+      profile1.state.get());
+  const auto &vector2 = *static_cast<const FrequencyVector<std::u32string> *>(
+      profile2.state.get());
+
+  double distance = compute_chebyshev_distance(vector1, vector2);
+  uint32_t int_distance = static_cast<uint32_t>(std::round(distance * 1000.0));
+  double similarity =
+      distance_to_similarity(static_cast<double>(int_distance) / 1000.0);
+  return Core::SimilarityResult{similarity};
+}
+
+double ChebyshevAlgorithm::compute_chebyshev_distance(
+    const FrequencyVector<std::u32string> &vector1,
+    const FrequencyVector<std::u32string> &vector2) const {
+  Core::ArenaScope scratch;
+  Core::PoolVector<uint32_t> counts1(scratch.allocator<uint32_t>());
+  Core::PoolVector<uint32_t> counts2(scratch.allocator<uint32_t>());
+  build_dense_pair(vector1, vector2, counts1, counts2);
 
-  return max_difference;
+  return dense_linf(counts1.data(), counts2.data(), counts1.size());
 }
 
 double
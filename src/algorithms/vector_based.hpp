@@ -3,7 +3,6 @@
 #include "base_algorithm.hpp"
 #include <cmath>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 namespace TextSimilarity::Algorithms {
@@ -28,6 +27,7 @@ public:
 
   void increment(const T &item, frequency_type count = 1) {
     frequencies_[item] += count;
+    cached_magnitude_ = -1.0; // Invalidate the cached norm
   }
 
   [[nodiscard]] frequency_type get_frequency(const T &item) const {
@@ -38,12 +38,17 @@ public:
   [[nodiscard]] size_t size() const noexcept { return frequencies_.size(); }
   [[nodiscard]] bool empty() const noexcept { return frequencies_.empty(); }
 
+  // Euclidean norm, computed on first use and cached until the next
+  // mutation; repeated cosine comparisons against the same vector reuse it
   [[nodiscard]] double magnitude() const {
-    double sum_squares = 0.0;
-    for (const auto &[item, freq] : frequencies_) {
-      sum_squares += static_cast<double>(freq) * static_cast<double>(freq);
+    if (cached_magnitude_ < 0.0) {
+      double sum_squares = 0.0;
+      for (const auto &[item, freq] : frequencies_) {
+        sum_squares += static_cast<double>(freq) * static_cast<double>(freq);
+      }
+      cached_magnitude_ = std::sqrt(sum_squares);
     }
-    return std::sqrt(sum_squares);
+    return cached_magnitude_;
   }
 
   [[nodiscard]] double dot_product(const FrequencyVector &other) const {
@@ -67,24 +72,12 @@ public:
   auto begin() const { return frequencies_.begin(); }
   auto end() const { return frequencies_.end(); }
 
-  // Get all unique terms from both vectors
-  static std::unordered_set<T> get_union_terms(const FrequencyVector &v1,
-                                               const FrequencyVector &v2) {
-    std::unordered_set<T> terms;
-
-    for (const auto &[term, freq] : v1.frequencies_) {
-      terms.insert(term);
-    }
-
-    for (const auto &[term, freq] : v2.frequencies_) {
-      terms.insert(term);
-    }
-
-    return terms;
-  }
-
 private:
   vector_map frequencies_;
+
+  // Negative means "not yet computed"; mutable so the norm can be filled
+  // in lazily from const accessors
+  mutable double cached_magnitude_{-1.0};
 };
 
 // Cosine similarity implementation
@@ -119,6 +112,19 @@ protected:
 
   bool is_symmetric_impl() const noexcept override { return true; }
 
+  [[nodiscard]] std::shared_ptr<void>
+  prepare_query_state(const Core::UnicodeString &processed_query,
+                      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_prepared_impl(
+      const PreparedQuery &prepared,
+      const Core::UnicodeString &processed_candidate,
+      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_profiles_impl(
+      const PreparedQuery &profile1, const PreparedQuery &profile2,
+      const Core::AlgorithmConfig &config) const override;
+
 private:
   [[nodiscard]] double compute_cosine_similarity(
       const FrequencyVector<std::u32string> &vector1,
@@ -133,8 +139,6 @@ private:
   [[nodiscard]] double
   compute_cosine_simd(const std::string &s1, const std::string &s2,
                       const Core::AlgorithmConfig &config) const;
-
-  [[nodiscard]] bool is_ascii_string(const std::string &str) const noexcept;
 };
 
 // Euclidean distance for vector-based comparison
@@ -170,6 +174,19 @@ protected:
   bool is_symmetric_impl() const noexcept override { return true; }
   bool is_metric_impl() const noexcept override { return true; }
 
+  [[nodiscard]] std::shared_ptr<void>
+  prepare_query_state(const Core::UnicodeString &processed_query,
+                      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_prepared_impl(
+      const PreparedQuery &prepared,
+      const Core::UnicodeString &processed_candidate,
+      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_profiles_impl(
+      const PreparedQuery &profile1, const PreparedQuery &profile2,
+      const Core::AlgorithmConfig &config) const override;
+
 private:
   [[nodiscard]] double compute_euclidean_distance(
       const FrequencyVector<std::u32string> &vector1,
@@ -211,6 +228,19 @@ protected:
   bool is_symmetric_impl() const noexcept override { return true; }
   bool is_metric_impl() const noexcept override { return true; }
 
+  [[nodiscard]] std::shared_ptr<void>
+  prepare_query_state(const Core::UnicodeString &processed_query,
+                      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_prepared_impl(
+      const PreparedQuery &prepared,
+      const Core::UnicodeString &processed_candidate,
+      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_profiles_impl(
+      const PreparedQuery &profile1, const PreparedQuery &profile2,
+      const Core::AlgorithmConfig &config) const override;
+
 private:
   [[nodiscard]] double compute_manhattan_distance(
       const FrequencyVector<std::u32string> &vector1,
@@ -252,6 +282,19 @@ protected:
   bool is_symmetric_impl() const noexcept override { return true; }
   bool is_metric_impl() const noexcept override { return true; }
 
+  [[nodiscard]] std::shared_ptr<void>
+  prepare_query_state(const Core::UnicodeString &processed_query,
+                      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_prepared_impl(
+      const PreparedQuery &prepared,
+      const Core::UnicodeString &processed_candidate,
+      const Core::AlgorithmConfig &config) const override;
+
+  [[nodiscard]] Core::SimilarityResult compute_similarity_profiles_impl(
+      const PreparedQuery &profile1, const PreparedQuery &profile2,
+      const Core::AlgorithmConfig &config) const override;
+
 private:
   [[nodiscard]] double compute_chebyshev_distance(
       const FrequencyVector<std::u32string> &vector1,
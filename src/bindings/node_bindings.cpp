@@ -1,6 +1,12 @@
 #include "node_bindings.hpp"
+#include "../core/memory_pool.hpp"
+#include "../core/statistics.hpp"
+#include "../index/corpus_index.hpp"
+#include "../index/inverted_index.hpp"
+#include "../lsh/minhash_index.hpp"
 #include <algorithm>
 #include <cctype>
+#include <limits>
 #include <unordered_map>
 
 namespace TextSimilarity::Bindings {
@@ -20,6 +26,36 @@ Napi::Object TextSimilarityAddon::Initialize(Napi::Env env,
   exports.Set("calculateDistance", Napi::Function::New(env, CalculateDistance));
   exports.Set("calculateSimilarityBatch",
               Napi::Function::New(env, CalculateSimilarityBatch));
+  exports.Set("calculateOneToMany", Napi::Function::New(env, CalculateOneToMany));
+  exports.Set("calculateOneToManyPacked",
+              Napi::Function::New(env, CalculateOneToManyPacked));
+  exports.Set("similarityMatrix", Napi::Function::New(env, SimilarityMatrix));
+  exports.Set("findTopK", Napi::Function::New(env, FindTopK));
+
+  // Export session methods
+  exports.Set("createSession", Napi::Function::New(env, CreateSession));
+
+  // Export incremental matcher methods
+  exports.Set("createIncrementalMatcher",
+              Napi::Function::New(env, CreateIncrementalMatcher));
+
+  // Export cascade methods
+  exports.Set("createCascade", Napi::Function::New(env, CreateCascade));
+
+  // Export profile methods
+  exports.Set("createProfile", Napi::Function::New(env, CreateProfile));
+
+  // Export corpus index methods
+  exports.Set("buildIndex", Napi::Function::New(env, BuildIndex));
+  exports.Set("loadIndex", Napi::Function::New(env, LoadIndex));
+
+  // Export inverted index methods
+  exports.Set("createInvertedIndex",
+              Napi::Function::New(env, CreateInvertedIndex));
+
+  // Export MinHash/LSH methods
+  exports.Set("buildSignatures", Napi::Function::New(env, BuildSignatures));
+  exports.Set("deduplicate", Napi::Function::New(env, Deduplicate));
 
   // Export asynchronous methods
   exports.Set("calculateSimilarityAsync",
@@ -28,6 +64,11 @@ Napi::Object TextSimilarityAddon::Initialize(Napi::Env env,
               Napi::Function::New(env, CalculateDistanceAsync));
   exports.Set("calculateSimilarityBatchAsync",
               Napi::Function::New(env, CalculateSimilarityBatchAsync));
+  exports.Set("calculateOneToManyAsync",
+              Napi::Function::New(env, CalculateOneToManyAsync));
+  exports.Set("similarityMatrixAsync",
+              Napi::Function::New(env, SimilarityMatrixAsync));
+  exports.Set("findTopKAsync", Napi::Function::New(env, FindTopKAsync));
 
   // Export configuration methods
   exports.Set("setGlobalConfiguration",
@@ -37,6 +78,14 @@ Napi::Object TextSimilarityAddon::Initialize(Napi::Env env,
   exports.Set("getSupportedAlgorithms",
               Napi::Function::New(env, GetSupportedAlgorithms));
   exports.Set("getMemoryUsage", Napi::Function::New(env, GetMemoryUsage));
+  exports.Set("getCacheStatistics",
+              Napi::Function::New(env, GetCacheStatistics));
+  exports.Set("getPrefilterStatistics",
+              Napi::Function::New(env, GetPrefilterStatistics));
+  exports.Set("getExecutorStatistics",
+              Napi::Function::New(env, GetExecutorStatistics));
+  exports.Set("getStatistics", Napi::Function::New(env, GetStatistics));
+  exports.Set("resetStatistics", Napi::Function::New(env, ResetStatistics));
   exports.Set("clearCaches", Napi::Function::New(env, ClearCaches));
 
   // Export utility methods
@@ -137,12 +186,14 @@ TextSimilarityAddon::CalculateSimilarity(const Napi::CallbackInfo &info) {
           env, "Expected at least 2 arguments: string1, string2");
     }
 
-    if (!ValidateStringInput(info[0]) || !ValidateStringInput(info[1])) {
-      throw Napi::TypeError::New(env, "Arguments must be strings");
+    if (!ValidateStringLikeInput(info[0]) || !ValidateStringLikeInput(info[1])) {
+      throw Napi::TypeError::New(env,
+                                 "Arguments must be strings or UTF-8 buffers");
     }
 
-    std::string s1 = info[0].As<Napi::String>().Utf8Value();
-    std::string s2 = info[1].As<Napi::String>().Utf8Value();
+    std::string storage1, storage2;
+    std::string_view s1 = ExtractStringView(info[0], storage1);
+    std::string_view s2 = ExtractStringView(info[1], storage2);
 
     Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
     if (info.Length() > 2 && info[2].IsNumber()) {
@@ -182,12 +233,14 @@ TextSimilarityAddon::CalculateDistance(const Napi::CallbackInfo &info) {
           env, "Expected at least 2 arguments: string1, string2");
     }
 
-    if (!ValidateStringInput(info[0]) || !ValidateStringInput(info[1])) {
-      throw Napi::TypeError::New(env, "Arguments must be strings");
+    if (!ValidateStringLikeInput(info[0]) || !ValidateStringLikeInput(info[1])) {
+      throw Napi::TypeError::New(env,
+                                 "Arguments must be strings or UTF-8 buffers");
     }
 
-    std::string s1 = info[0].As<Napi::String>().Utf8Value();
-    std::string s2 = info[1].As<Napi::String>().Utf8Value();
+    std::string storage1, storage2;
+    std::string_view s1 = ExtractStringView(info[0], storage1);
+    std::string_view s2 = ExtractStringView(info[1], storage2);
 
     Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
     if (info.Length() > 2) {
@@ -231,33 +284,1442 @@ TextSimilarityAddon::CalculateSimilarityBatch(const Napi::CallbackInfo &info) {
             env, "Each element must be an array of two strings");
       }
 
-      Napi::Array pair = pair_value.As<Napi::Array>();
-      if (pair.Length() != 2) {
-        throw Napi::TypeError::New(
-            env, "Each pair must contain exactly two strings");
-      }
+      Napi::Array pair = pair_value.As<Napi::Array>();
+      if (pair.Length() != 2) {
+        throw Napi::TypeError::New(
+            env, "Each pair must contain exactly two strings");
+      }
+
+      std::string s1 = pair.Get(0u).As<Napi::String>().Utf8Value();
+      std::string s2 = pair.Get(1u).As<Napi::String>().Utf8Value();
+      pairs.emplace_back(std::move(s1), std::move(s2));
+    }
+
+    Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
+    if (info.Length() > 1) {
+      algorithm = ExtractAlgorithmType(info[1]);
+    }
+
+    Core::AlgorithmConfig config{};
+    size_t concurrency = 0;
+    bool typed_array = false;
+    if (info.Length() > 2 && info[2].IsObject()) {
+      Napi::Object config_obj = info[2].As<Napi::Object>();
+      config = ExtractConfig(config_obj);
+      concurrency = ExtractConcurrency(config_obj);
+      typed_array = ExtractTypedArrayFormat(config_obj);
+    }
+
+    auto results =
+        engine_->calculate_similarity_batch(pairs, algorithm, config,
+                                            concurrency);
+
+    if (typed_array) {
+      return TypedResultsToObject(env, results);
+    }
+
+    Napi::Array result_array = Napi::Array::New(env, results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      result_array.Set(i, ResultToObject(env, results[i]));
+    }
+
+    return result_array;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::CalculateOneToMany(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 2) {
+      throw Napi::TypeError::New(
+          env, "Expected at least 2 arguments: query, candidates");
+    }
+
+    if (!ValidateStringLikeInput(info[0])) {
+      throw Napi::TypeError::New(env, "Query must be a string or UTF-8 buffer");
+    }
+
+    if (!info[1].IsArray()) {
+      throw Napi::TypeError::New(
+          env, "Expected array of candidate strings as second argument");
+    }
+
+    std::string query_storage;
+    std::string_view query = ExtractStringView(info[0], query_storage);
+
+    Napi::Array candidates_array = info[1].As<Napi::Array>();
+    const size_t candidate_count = candidates_array.Length();
+
+    // Storage is sized up front so views into it stay stable
+    std::vector<std::string> candidate_storage(candidate_count);
+    std::vector<std::string_view> candidates(candidate_count);
+
+    for (uint32_t i = 0; i < candidate_count; ++i) {
+      Napi::Value candidate = candidates_array.Get(i);
+      if (!ValidateStringLikeInput(candidate)) {
+        throw Napi::TypeError::New(
+            env, "Each candidate must be a string or UTF-8 buffer");
+      }
+      candidates[i] = ExtractStringView(candidate, candidate_storage[i]);
+    }
+
+    Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
+    if (info.Length() > 2) {
+      algorithm = ExtractAlgorithmType(info[2]);
+    }
+
+    Core::AlgorithmConfig config{};
+    bool typed_array = false;
+    if (info.Length() > 3 && info[3].IsObject()) {
+      config = ExtractConfig(info[3].As<Napi::Object>());
+      typed_array = ExtractTypedArrayFormat(info[3].As<Napi::Object>());
+    }
+
+    auto results =
+        engine_->calculate_one_to_many(query, candidates, algorithm, config);
+
+    if (typed_array) {
+      return TypedResultsToObject(env, results);
+    }
+
+    Napi::Array result_array = Napi::Array::New(env, results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      result_array.Set(i, ResultToObject(env, results[i]));
+    }
+
+    return result_array;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+// Packed one-to-many: the candidate set arrives as one concatenated UTF-8
+// buffer plus a Uint32Array of n+1 byte offsets, so n candidates cross the
+// JS/C++ boundary as two typed arrays instead of n string copies
+Napi::Value
+TextSimilarityAddon::CalculateOneToManyPacked(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 3) {
+      throw Napi::TypeError::New(
+          env, "Expected at least 3 arguments: query, buffer, offsets");
+    }
+
+    if (!ValidateStringLikeInput(info[0])) {
+      throw Napi::TypeError::New(env, "Query must be a string or UTF-8 buffer");
+    }
+
+    if (!info[1].IsBuffer() &&
+        !(info[1].IsTypedArray() &&
+          info[1].As<Napi::TypedArray>().TypedArrayType() ==
+              napi_uint8_array)) {
+      throw Napi::TypeError::New(
+          env, "Candidates must be a Buffer or Uint8Array of UTF-8 bytes");
+    }
+
+    if (!info[2].IsTypedArray() ||
+        info[2].As<Napi::TypedArray>().TypedArrayType() != napi_uint32_array) {
+      throw Napi::TypeError::New(
+          env, "Offsets must be a Uint32Array of candidate boundaries");
+    }
+
+    std::string query_storage;
+    std::string_view query = ExtractStringView(info[0], query_storage);
+
+    std::string buffer_storage;
+    std::string_view buffer = ExtractStringView(info[1], buffer_storage);
+
+    auto offsets = info[2].As<Napi::Uint32Array>();
+    if (offsets.ElementLength() == 0) {
+      throw Napi::TypeError::New(
+          env, "Offsets must contain at least one boundary");
+    }
+
+    const size_t candidate_count = offsets.ElementLength() - 1;
+    std::vector<std::string_view> candidates(candidate_count);
+
+    for (size_t i = 0; i < candidate_count; ++i) {
+      const uint32_t begin = offsets[i];
+      const uint32_t end = offsets[i + 1];
+      if (begin > end || end > buffer.size()) {
+        throw Napi::RangeError::New(
+            env, "Offsets must be non-decreasing and within the buffer");
+      }
+      candidates[i] = buffer.substr(begin, end - begin);
+    }
+
+    Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
+    if (info.Length() > 3) {
+      algorithm = ExtractAlgorithmType(info[3]);
+    }
+
+    Core::AlgorithmConfig config{};
+    if (info.Length() > 4 && info[4].IsObject()) {
+      config = ExtractConfig(info[4].As<Napi::Object>());
+    }
+
+    auto results =
+        engine_->calculate_one_to_many(query, candidates, algorithm, config);
+
+    Napi::Array result_array = Napi::Array::New(env, results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      result_array.Set(i, ResultToObject(env, results[i]));
+    }
+
+    return result_array;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+TextSimilarityAddon::TopKArguments
+TextSimilarityAddon::ParseTopKArguments(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() < 3) {
+    throw Napi::TypeError::New(
+        env, "Expected at least 3 arguments: query, candidates, k");
+  }
+
+  if (!info[0].IsString()) {
+    throw Napi::TypeError::New(env, "Query must be a string");
+  }
+
+  if (!info[1].IsArray()) {
+    throw Napi::TypeError::New(
+        env, "Expected array of candidate strings as second argument");
+  }
+
+  if (!info[2].IsNumber()) {
+    throw Napi::TypeError::New(env, "k must be a number");
+  }
+
+  TopKArguments args;
+  args.query = info[0].As<Napi::String>().Utf8Value();
+
+  Napi::Array candidates_array = info[1].As<Napi::Array>();
+  args.candidates.reserve(candidates_array.Length());
+  for (uint32_t i = 0; i < candidates_array.Length(); ++i) {
+    Napi::Value candidate = candidates_array.Get(i);
+    if (!candidate.IsString()) {
+      throw Napi::TypeError::New(env, "Each candidate must be a string");
+    }
+    args.candidates.push_back(candidate.As<Napi::String>().Utf8Value());
+  }
+
+  args.k = static_cast<size_t>(info[2].As<Napi::Number>().Uint32Value());
+
+  if (info.Length() > 3 && info[3].IsNumber()) {
+    args.min_similarity = info[3].As<Napi::Number>().DoubleValue();
+  }
+
+  if (info.Length() > 4) {
+    args.algorithm = ExtractAlgorithmType(info[4]);
+  }
+
+  if (info.Length() > 5 && info[5].IsObject()) {
+    args.config = ExtractConfig(info[5].As<Napi::Object>());
+  }
+
+  return args;
+}
+
+Napi::Value TextSimilarityAddon::FindTopK(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    auto args = ParseTopKArguments(info);
+
+    auto matches =
+        engine_->find_top_k(args.query, args.candidates, args.k,
+                            args.min_similarity, args.algorithm, args.config);
+
+    Napi::Array result_array = Napi::Array::New(env, matches.size());
+    for (size_t i = 0; i < matches.size(); ++i) {
+      Napi::Object match = Napi::Object::New(env);
+      match.Set("index", Napi::Number::New(
+                             env, static_cast<double>(matches[i].index)));
+      match.Set("similarity", Napi::Number::New(env, matches[i].similarity));
+      result_array.Set(i, match);
+    }
+
+    return result_array;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::FindTopKAsync(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    auto args = ParseTopKArguments(info);
+
+    auto *worker = new TopKAsyncWorker(
+        env, std::move(args.query), std::move(args.candidates), args.k,
+        args.min_similarity, args.algorithm, std::move(args.config),
+        engine_.get());
+    auto promise = worker->GetPromise();
+    worker->Queue();
+
+    return promise;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::SimilarityMatrix(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 1 || !info[0].IsArray()) {
+      throw Napi::TypeError::New(env,
+                                 "Expected array of strings as first argument");
+    }
+
+    Napi::Array strings_array = info[0].As<Napi::Array>();
+    std::vector<std::string> strings;
+    strings.reserve(strings_array.Length());
+
+    for (uint32_t i = 0; i < strings_array.Length(); ++i) {
+      Napi::Value element = strings_array.Get(i);
+      if (!element.IsString()) {
+        throw Napi::TypeError::New(env, "Each element must be a string");
+      }
+      strings.push_back(element.As<Napi::String>().Utf8Value());
+    }
+
+    Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
+    if (info.Length() > 1) {
+      algorithm = ExtractAlgorithmType(info[1]);
+    }
+
+    Core::AlgorithmConfig config{};
+    size_t concurrency = 0;
+    if (info.Length() > 2 && info[2].IsObject()) {
+      config = ExtractConfig(info[2].As<Napi::Object>());
+      concurrency = ExtractConcurrency(info[2].As<Napi::Object>());
+    }
+
+    auto matrix =
+        engine_->similarity_matrix(strings, algorithm, config, concurrency);
+
+    auto typed_array = Napi::Float64Array::New(env, matrix.size());
+    std::copy(matrix.begin(), matrix.end(), typed_array.Data());
+
+    return typed_array;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::SimilarityMatrixAsync(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 1 || !info[0].IsArray()) {
+      throw Napi::TypeError::New(env,
+                                 "Expected array of strings as first argument");
+    }
+
+    Napi::Array strings_array = info[0].As<Napi::Array>();
+    std::vector<std::string> strings;
+    strings.reserve(strings_array.Length());
+
+    for (uint32_t i = 0; i < strings_array.Length(); ++i) {
+      Napi::Value element = strings_array.Get(i);
+      if (!element.IsString()) {
+        throw Napi::TypeError::New(env, "Each element must be a string");
+      }
+      strings.push_back(element.As<Napi::String>().Utf8Value());
+    }
+
+    Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
+    if (info.Length() > 1) {
+      algorithm = ExtractAlgorithmType(info[1]);
+    }
+
+    Core::AlgorithmConfig config{};
+    size_t concurrency = 0;
+    if (info.Length() > 2 && info[2].IsObject()) {
+      config = ExtractConfig(info[2].As<Napi::Object>());
+      concurrency = ExtractConcurrency(info[2].As<Napi::Object>());
+    }
+
+    auto *worker =
+        new MatrixAsyncWorker(env, std::move(strings), algorithm,
+                              std::move(config), engine_.get(), concurrency);
+    auto promise = worker->GetPromise();
+    worker->Queue();
+
+    return promise;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::CreateSession(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 1) {
+      throw Napi::TypeError::New(env,
+                                 "Expected at least 1 argument: algorithm");
+    }
+
+    Core::AlgorithmType algorithm = ExtractAlgorithmType(info[0]);
+
+    Core::AlgorithmConfig config{};
+    if (info.Length() > 1 && info[1].IsObject()) {
+      config = ExtractConfig(info[1].As<Napi::Object>());
+    }
+
+    // The algorithm instance lives as long as the session object; the
+    // closures below share ownership so method calls stay valid even if the
+    // session object outlives this scope
+    std::shared_ptr<Core::ISimilaritySession> session =
+        engine_->create_session(algorithm, config);
+
+    Napi::Object session_obj = Napi::Object::New(env);
+
+    session_obj.Set(
+        "similarity",
+        Napi::Function::New(
+            env, [session](const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 2 || !ValidateStringInput(call[0]) ||
+                    !ValidateStringInput(call[1])) {
+                  throw Napi::TypeError::New(
+                      env, "Expected 2 string arguments: string1, string2");
+                }
+
+                std::string s1 = call[0].As<Napi::String>().Utf8Value();
+                std::string s2 = call[1].As<Napi::String>().Utf8Value();
+
+                return ResultToObject(env,
+                                      session->calculate_similarity(s1, s2));
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    session_obj.Set(
+        "distance",
+        Napi::Function::New(
+            env, [session](const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 2 || !ValidateStringInput(call[0]) ||
+                    !ValidateStringInput(call[1])) {
+                  throw Napi::TypeError::New(
+                      env, "Expected 2 string arguments: string1, string2");
+                }
+
+                std::string s1 = call[0].As<Napi::String>().Utf8Value();
+                std::string s2 = call[1].As<Napi::String>().Utf8Value();
+
+                return ResultToObject(env,
+                                      session->calculate_distance(s1, s2));
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    session_obj.Set("algorithmType",
+                    Napi::Number::New(env, static_cast<int>(
+                                               session->get_algorithm_type())));
+    session_obj.Set(
+        "algorithmName",
+        Napi::String::New(
+            env, Core::get_algorithm_name(session->get_algorithm_type())));
+    session_obj.Set("getConfiguration",
+                    Napi::Function::New(
+                        env, [session](const Napi::CallbackInfo &call)
+                                 -> Napi::Value {
+                          return ConfigToObject(call.Env(),
+                                                session->get_configuration());
+                        }));
+
+    return session_obj;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::CreateIncrementalMatcher(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 1 || !info[0].IsArray()) {
+      throw Napi::TypeError::New(
+          env, "Expected array of candidate strings as first argument");
+    }
+
+    Napi::Array candidates_array = info[0].As<Napi::Array>();
+    std::vector<std::string> candidates;
+    candidates.reserve(candidates_array.Length());
+    for (uint32_t i = 0; i < candidates_array.Length(); ++i) {
+      Napi::Value candidate = candidates_array.Get(i);
+      if (!candidate.IsString()) {
+        throw Napi::TypeError::New(env, "Each candidate must be a string");
+      }
+      candidates.push_back(candidate.As<Napi::String>().Utf8Value());
+    }
+
+    Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
+    if (info.Length() > 1) {
+      algorithm = ExtractAlgorithmType(info[1]);
+    }
+
+    Core::AlgorithmConfig config{};
+    if (info.Length() > 2 && info[2].IsObject()) {
+      config = ExtractConfig(info[2].As<Napi::Object>());
+    }
+
+    // Shared ownership keeps the retained DP rows alive for as long as the
+    // returned object (or any of its closures) is reachable from JS
+    std::shared_ptr<Core::IIncrementalMatcher> matcher =
+        engine_->create_incremental_matcher(std::move(candidates), algorithm,
+                                            config);
+
+    Napi::Object matcher_obj = Napi::Object::New(env);
+
+    matcher_obj.Set(
+        "update",
+        Napi::Function::New(
+            env, [matcher](const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 1 || !ValidateStringInput(call[0])) {
+                  throw Napi::TypeError::New(
+                      env, "Expected query string as first argument");
+                }
+
+                std::string query = call[0].As<Napi::String>().Utf8Value();
+
+                size_t k = matcher->candidate_count();
+                if (call.Length() > 1 && call[1].IsNumber()) {
+                  k = static_cast<size_t>(
+                      call[1].As<Napi::Number>().Uint32Value());
+                }
+
+                double min_similarity = 0.0;
+                if (call.Length() > 2 && call[2].IsNumber()) {
+                  min_similarity = call[2].As<Napi::Number>().DoubleValue();
+                }
+
+                auto matches = matcher->update(query, k, min_similarity);
+
+                Napi::Array result_array = Napi::Array::New(env, matches.size());
+                for (size_t i = 0; i < matches.size(); ++i) {
+                  Napi::Object match = Napi::Object::New(env);
+                  match.Set("index",
+                            Napi::Number::New(
+                                env, static_cast<double>(matches[i].index)));
+                  match.Set("similarity",
+                            Napi::Number::New(env, matches[i].similarity));
+                  result_array.Set(i, match);
+                }
+
+                return result_array;
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    matcher_obj.Set(
+        "reset", Napi::Function::New(
+                     env, [matcher](const Napi::CallbackInfo &call)
+                              -> Napi::Value {
+                       matcher->reset();
+                       return call.Env().Undefined();
+                     }));
+
+    matcher_obj.Set("candidateCount",
+                    Napi::Number::New(env, static_cast<double>(
+                                               matcher->candidate_count())));
+    matcher_obj.Set("algorithmType",
+                    Napi::Number::New(env, static_cast<int>(
+                                               matcher->get_algorithm_type())));
+    matcher_obj.Set(
+        "algorithmName",
+        Napi::String::New(
+            env, Core::get_algorithm_name(matcher->get_algorithm_type())));
+
+    return matcher_obj;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::CreateCascade(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 1 || !info[0].IsArray()) {
+      throw Napi::TypeError::New(
+          env, "Expected array of cascade stages as first argument");
+    }
+
+    Napi::Array stages_array = info[0].As<Napi::Array>();
+    if (stages_array.Length() == 0) {
+      throw Napi::TypeError::New(env,
+                                 "Cascade requires at least one stage");
+    }
+
+    std::vector<Core::CascadeStage> stages;
+    stages.reserve(stages_array.Length());
+    for (uint32_t i = 0; i < stages_array.Length(); ++i) {
+      Napi::Value stage_value = stages_array.Get(i);
+      if (!stage_value.IsObject()) {
+        throw Napi::TypeError::New(
+            env, "Each stage must be an object with algorithm and minScore");
+      }
+      Napi::Object stage_obj = stage_value.As<Napi::Object>();
+
+      Core::CascadeStage stage;
+      if (!stage_obj.Has("algorithm")) {
+        throw Napi::TypeError::New(env,
+                                   "Each stage must name an algorithm");
+      }
+      stage.algorithm = ExtractAlgorithmType(stage_obj.Get("algorithm"));
+
+      if (stage_obj.Has("config") && stage_obj.Get("config").IsObject()) {
+        stage.config = ExtractConfig(stage_obj.Get("config").As<Napi::Object>());
+      }
+
+      if (stage_obj.Has("minScore") && stage_obj.Get("minScore").IsNumber()) {
+        stage.min_score = stage_obj.Get("minScore").As<Napi::Number>().DoubleValue();
+      }
+
+      stages.push_back(std::move(stage));
+    }
+
+    // The stage algorithms live as long as the cascade object; the
+    // closures below share ownership
+    std::shared_ptr<Core::ICascade> cascade =
+        engine_->create_cascade(std::move(stages));
+
+    auto outcome_to_object = [](Napi::Env env,
+                                const Core::CascadeResult &result)
+        -> Napi::Object {
+      Napi::Object obj = Napi::Object::New(env);
+      if (result.is_success()) {
+        const auto &outcome = result.value();
+        obj.Set("success", Napi::Boolean::New(env, true));
+        obj.Set("passed", Napi::Boolean::New(env, outcome.passed));
+        obj.Set("stage", Napi::Number::New(env, outcome.stage));
+        obj.Set("score", Napi::Number::New(env, outcome.score));
+      } else {
+        obj.Set("success", Napi::Boolean::New(env, false));
+        obj.Set("error", CreateError(env, result.error()).Value());
+      }
+      return obj;
+    };
+
+    Napi::Object cascade_obj = Napi::Object::New(env);
+
+    cascade_obj.Set("stageCount",
+                    Napi::Number::New(
+                        env, static_cast<double>(cascade->stage_count())));
+
+    cascade_obj.Set(
+        "similarity",
+        Napi::Function::New(
+            env, [cascade, outcome_to_object](
+                     const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 2 || !ValidateStringLikeInput(call[0]) ||
+                    !ValidateStringLikeInput(call[1])) {
+                  throw Napi::TypeError::New(
+                      env, "Expected 2 string arguments: string1, string2");
+                }
+
+                std::string storage1, storage2;
+                std::string_view s1 = ExtractStringView(call[0], storage1);
+                std::string_view s2 = ExtractStringView(call[1], storage2);
+
+                return outcome_to_object(env, cascade->evaluate(s1, s2));
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    cascade_obj.Set(
+        "similarityBatch",
+        Napi::Function::New(
+            env, [cascade, outcome_to_object](
+                     const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 1 || !call[0].IsArray()) {
+                  throw Napi::TypeError::New(
+                      env, "Expected array of string pairs as first argument");
+                }
+
+                Napi::Array pairs_array = call[0].As<Napi::Array>();
+                std::vector<std::pair<std::string, std::string>> pairs;
+                pairs.reserve(pairs_array.Length());
+                for (uint32_t i = 0; i < pairs_array.Length(); ++i) {
+                  Napi::Value pair_value = pairs_array.Get(i);
+                  if (!pair_value.IsArray()) {
+                    throw Napi::TypeError::New(
+                        env, "Each element must be an array of two strings");
+                  }
+                  Napi::Array pair = pair_value.As<Napi::Array>();
+                  if (pair.Length() != 2) {
+                    throw Napi::TypeError::New(
+                        env, "Each pair must contain exactly two strings");
+                  }
+                  pairs.emplace_back(
+                      pair.Get(0u).As<Napi::String>().Utf8Value(),
+                      pair.Get(1u).As<Napi::String>().Utf8Value());
+                }
+
+                auto results = cascade->evaluate_batch(pairs);
+
+                Napi::Array result_array = Napi::Array::New(env,
+                                                            results.size());
+                for (size_t i = 0; i < results.size(); ++i) {
+                  result_array.Set(i, outcome_to_object(env, results[i]));
+                }
+
+                return result_array;
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    cascade_obj.Set(
+        "match",
+        Napi::Function::New(
+            env, [cascade](const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 2 || !ValidateStringLikeInput(call[0]) ||
+                    !call[1].IsArray()) {
+                  throw Napi::TypeError::New(
+                      env,
+                      "Expected 2 arguments: query, candidates array");
+                }
+
+                std::string storage;
+                std::string_view query = ExtractStringView(call[0], storage);
+
+                Napi::Array candidates_array = call[1].As<Napi::Array>();
+                std::vector<std::string> owned;
+                owned.reserve(candidates_array.Length());
+                for (uint32_t i = 0; i < candidates_array.Length(); ++i) {
+                  Napi::Value candidate = candidates_array.Get(i);
+                  if (!candidate.IsString()) {
+                    throw Napi::TypeError::New(
+                        env, "Each candidate must be a string");
+                  }
+                  owned.push_back(candidate.As<Napi::String>().Utf8Value());
+                }
+                std::vector<std::string_view> candidates(owned.begin(),
+                                                         owned.end());
+
+                auto matches = cascade->match(query, candidates);
+
+                Napi::Array result_array = Napi::Array::New(env,
+                                                            matches.size());
+                for (size_t i = 0; i < matches.size(); ++i) {
+                  Napi::Object match = Napi::Object::New(env);
+                  match.Set("index",
+                            Napi::Number::New(
+                                env, static_cast<double>(matches[i].index)));
+                  match.Set("similarity",
+                            Napi::Number::New(env, matches[i].similarity));
+                  result_array.Set(i, match);
+                }
+
+                return result_array;
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    return cascade_obj;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::CreateProfile(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 1 || !ValidateStringLikeInput(info[0])) {
+      throw Napi::TypeError::New(
+          env, "Expected at least 1 argument: text (string or UTF-8 buffer)");
+    }
+
+    std::string storage;
+    std::string_view text = ExtractStringView(info[0], storage);
+
+    Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
+    if (info.Length() > 1) {
+      algorithm = ExtractAlgorithmType(info[1]);
+    }
+
+    Core::AlgorithmConfig config{};
+    if (info.Length() > 2 && info[2].IsObject()) {
+      config = ExtractConfig(info[2].As<Napi::Object>());
+    }
+
+    // The profile (algorithm instance plus prepared document state) lives as
+    // long as the profile object; the closures below share ownership
+    std::shared_ptr<Core::IDocumentProfile> profile =
+        engine_->create_profile(text, algorithm, config);
+
+    Napi::Object profile_obj = Napi::Object::New(env);
+
+    // Native handle so profile-vs-profile comparisons can reach the other
+    // side's precomputed state without a round-trip through JS values
+    profile_obj.Set(
+        "_native",
+        Napi::External<std::shared_ptr<Core::IDocumentProfile>>::New(
+            env, new std::shared_ptr<Core::IDocumentProfile>(profile),
+            [](Napi::Env,
+               std::shared_ptr<Core::IDocumentProfile> *data) { delete data; }));
+
+    profile_obj.Set(
+        "similarity",
+        Napi::Function::New(
+            env, [profile](const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 1) {
+                  throw Napi::TypeError::New(
+                      env, "Expected 1 argument: profile or text");
+                }
+
+                // Another profile object: compare precomputed state directly
+                if (call[0].IsObject()) {
+                  Napi::Value native =
+                      call[0].As<Napi::Object>().Get("_native");
+                  if (native.IsExternal()) {
+                    auto *other =
+                        native
+                            .As<Napi::External<
+                                std::shared_ptr<Core::IDocumentProfile>>>()
+                            .Data();
+                    return ResultToObject(env, profile->similarity_to(**other));
+                  }
+                }
+
+                // Raw text: only the candidate side is tokenized per call
+                if (ValidateStringLikeInput(call[0])) {
+                  std::string storage;
+                  std::string_view text = ExtractStringView(call[0], storage);
+                  return ResultToObject(
+                      env, profile->similarity_to_text(std::string(text)));
+                }
+
+                throw Napi::TypeError::New(
+                    env, "Argument must be a profile or a string/UTF-8 buffer");
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    profile_obj.Set("algorithmType",
+                    Napi::Number::New(env, static_cast<int>(
+                                               profile->get_algorithm_type())));
+    profile_obj.Set(
+        "algorithmName",
+        Napi::String::New(
+            env, Core::get_algorithm_name(profile->get_algorithm_type())));
+    profile_obj.Set("getConfiguration",
+                    Napi::Function::New(
+                        env, [profile](const Napi::CallbackInfo &call)
+                                 -> Napi::Value {
+                          return ConfigToObject(call.Env(),
+                                                profile->get_configuration());
+                        }));
+
+    return profile_obj;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value TextSimilarityAddon::BuildIndex(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 2 || !info[0].IsArray() || !info[1].IsString()) {
+      throw Napi::TypeError::New(
+          env, "Expected at least 2 arguments: strings array, path");
+    }
+
+    Napi::Array strings_array = info[0].As<Napi::Array>();
+    std::vector<std::string> strings;
+    strings.reserve(strings_array.Length());
+    for (uint32_t i = 0; i < strings_array.Length(); ++i) {
+      Napi::Value entry = strings_array.Get(i);
+      if (!entry.IsString()) {
+        throw Napi::TypeError::New(env, "Each document must be a string");
+      }
+      strings.push_back(entry.As<Napi::String>().Utf8Value());
+    }
+
+    std::string path = info[1].As<Napi::String>().Utf8Value();
+
+    // The configuration fixes the preprocessing snapshot baked into the
+    // index; queries against the index inherit it
+    Core::AlgorithmConfig config{};
+    if (info.Length() > 2 && info[2].IsObject()) {
+      config = ExtractConfig(info[2].As<Napi::Object>());
+    }
+
+    Index::CorpusIndex::build(strings, config, path);
+
+    return env.Undefined();
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value TextSimilarityAddon::LoadIndex(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 1 || !info[0].IsString()) {
+      throw Napi::TypeError::New(env, "Expected 1 argument: path");
+    }
+
+    std::string path = info[0].As<Napi::String>().Utf8Value();
+
+    // The mapping lives as long as the index object; the closures below
+    // share ownership
+    std::shared_ptr<Index::CorpusIndex> index = Index::CorpusIndex::load(path);
+
+    Napi::Object index_obj = Napi::Object::New(env);
+
+    index_obj.Set("size",
+                  Napi::Number::New(env, static_cast<double>(index->size())));
+
+    index_obj.Set(
+        "oneToMany",
+        Napi::Function::New(
+            env, [index](const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 1 || !ValidateStringLikeInput(call[0])) {
+                  throw Napi::TypeError::New(
+                      env, "Expected at least 1 argument: query");
+                }
+
+                std::string storage;
+                std::string_view query = ExtractStringView(call[0], storage);
+
+                Core::AlgorithmType algorithm =
+                    Core::AlgorithmType::Levenshtein;
+                if (call.Length() > 1) {
+                  algorithm = ExtractAlgorithmType(call[1]);
+                }
+
+                Core::AlgorithmConfig config{};
+                if (call.Length() > 2 && call[2].IsObject()) {
+                  config = ExtractConfig(call[2].As<Napi::Object>());
+                }
+
+                auto results = engine_->calculate_one_to_many_indexed(
+                    query, *index, algorithm, config);
+
+                Napi::Array result_array = Napi::Array::New(env,
+                                                            results.size());
+                for (size_t i = 0; i < results.size(); ++i) {
+                  result_array.Set(i, ResultToObject(env, results[i]));
+                }
+
+                return result_array;
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    index_obj.Set(
+        "findTopK",
+        Napi::Function::New(
+            env, [index](const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 2 || !ValidateStringLikeInput(call[0]) ||
+                    !call[1].IsNumber()) {
+                  throw Napi::TypeError::New(
+                      env, "Expected at least 2 arguments: query, k");
+                }
+
+                std::string storage;
+                std::string_view query = ExtractStringView(call[0], storage);
+                size_t k = static_cast<size_t>(
+                    call[1].As<Napi::Number>().Uint32Value());
+
+                double min_similarity = 0.0;
+                if (call.Length() > 2 && call[2].IsNumber()) {
+                  min_similarity = call[2].As<Napi::Number>().DoubleValue();
+                }
+
+                Core::AlgorithmType algorithm =
+                    Core::AlgorithmType::Levenshtein;
+                if (call.Length() > 3) {
+                  algorithm = ExtractAlgorithmType(call[3]);
+                }
+
+                Core::AlgorithmConfig config{};
+                if (call.Length() > 4 && call[4].IsObject()) {
+                  config = ExtractConfig(call[4].As<Napi::Object>());
+                }
+
+                auto matches = engine_->find_top_k_indexed(
+                    query, *index, k, min_similarity, algorithm, config);
+
+                Napi::Array result_array = Napi::Array::New(env,
+                                                            matches.size());
+                for (size_t i = 0; i < matches.size(); ++i) {
+                  Napi::Object match = Napi::Object::New(env);
+                  match.Set("index",
+                            Napi::Number::New(
+                                env, static_cast<double>(matches[i].index)));
+                  match.Set("similarity",
+                            Napi::Number::New(env, matches[i].similarity));
+                  result_array.Set(i, match);
+                }
+
+                return result_array;
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    index_obj.Set(
+        "getConfiguration",
+        Napi::Function::New(env,
+                            [index](const Napi::CallbackInfo &call)
+                                -> Napi::Value {
+                              return ConfigToObject(
+                                  call.Env(), index->preprocessing_config());
+                            }));
+
+    return index_obj;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::CreateInvertedIndex(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 1 || !info[0].IsArray()) {
+      throw Napi::TypeError::New(
+          env, "Expected at least 1 argument: strings array");
+    }
+
+    Napi::Array strings_array = info[0].As<Napi::Array>();
+    std::vector<std::string> strings;
+    strings.reserve(strings_array.Length());
+    for (uint32_t i = 0; i < strings_array.Length(); ++i) {
+      Napi::Value entry = strings_array.Get(i);
+      if (!entry.IsString()) {
+        throw Napi::TypeError::New(env, "Each document must be a string");
+      }
+      strings.push_back(entry.As<Napi::String>().Utf8Value());
+    }
+
+    Core::AlgorithmConfig config{};
+    config.preprocessing = Core::PreprocessingMode::NGram;
+    if (info.Length() > 1 && info[1].IsObject()) {
+      config = ExtractConfig(info[1].As<Napi::Object>());
+    }
+
+    // Postings, counters and preprocessed texts live as long as the index
+    // object; the query closure shares ownership
+    auto index =
+        std::make_shared<Index::NGramInvertedIndex>(strings, config);
+
+    Napi::Object index_obj = Napi::Object::New(env);
+
+    index_obj.Set("size",
+                  Napi::Number::New(env, static_cast<double>(index->size())));
+
+    index_obj.Set(
+        "query",
+        Napi::Function::New(
+            env, [index](const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 1 || !ValidateStringLikeInput(call[0])) {
+                  throw Napi::TypeError::New(
+                      env, "Expected at least 1 argument: query");
+                }
+
+                std::string storage;
+                std::string_view text = ExtractStringView(call[0], storage);
+
+                double min_similarity = 0.0;
+                if (call.Length() > 1 && call[1].IsNumber()) {
+                  min_similarity = call[1].As<Napi::Number>().DoubleValue();
+                }
+
+                Core::AlgorithmType algorithm = Core::AlgorithmType::Jaccard;
+                if (call.Length() > 2) {
+                  algorithm = ExtractAlgorithmType(call[2]);
+                }
+
+                auto matches = index->query(text, min_similarity, algorithm);
+
+                Napi::Array result_array = Napi::Array::New(env,
+                                                            matches.size());
+                for (size_t i = 0; i < matches.size(); ++i) {
+                  Napi::Object match = Napi::Object::New(env);
+                  match.Set("index",
+                            Napi::Number::New(
+                                env, static_cast<double>(matches[i].index)));
+                  match.Set("similarity",
+                            Napi::Number::New(env, matches[i].similarity));
+                  result_array.Set(i, match);
+                }
+
+                return result_array;
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    return index_obj;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::BuildSignatures(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 1 || !info[0].IsArray()) {
+      throw Napi::TypeError::New(
+          env, "Expected at least 1 argument: strings array");
+    }
+
+    Napi::Array strings_array = info[0].As<Napi::Array>();
+    std::vector<std::string> strings;
+    strings.reserve(strings_array.Length());
+    for (uint32_t i = 0; i < strings_array.Length(); ++i) {
+      Napi::Value entry = strings_array.Get(i);
+      if (!entry.IsString()) {
+        throw Napi::TypeError::New(env, "Each document must be a string");
+      }
+      strings.push_back(entry.As<Napi::String>().Utf8Value());
+    }
+
+    Core::AlgorithmConfig config{};
+    config.preprocessing = Core::PreprocessingMode::NGram;
+    if (info.Length() > 1 && info[1].IsObject()) {
+      config = ExtractConfig(info[1].As<Napi::Object>());
+    }
+
+    // Signatures, band buckets and counters live as long as the index
+    // object; the closures below share ownership
+    auto index = std::make_shared<LSH::MinHashIndex>(strings, config);
+
+    Napi::Object index_obj = Napi::Object::New(env);
+
+    index_obj.Set("size",
+                  Napi::Number::New(env, static_cast<double>(index->size())));
+    index_obj.Set("permutations",
+                  Napi::Number::New(env, index->permutations()));
+    index_obj.Set("bands", Napi::Number::New(env, index->bands()));
+
+    index_obj.Set(
+        "queryNear",
+        Napi::Function::New(
+            env, [index](const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 1 || !ValidateStringLikeInput(call[0])) {
+                  throw Napi::TypeError::New(
+                      env, "Expected at least 1 argument: query");
+                }
+
+                std::string storage;
+                std::string_view text = ExtractStringView(call[0], storage);
+
+                double min_similarity = 0.0;
+                if (call.Length() > 1 && call[1].IsNumber()) {
+                  min_similarity = call[1].As<Napi::Number>().DoubleValue();
+                }
+
+                auto matches = index->query_near(text, min_similarity);
+
+                Napi::Array result_array = Napi::Array::New(env,
+                                                            matches.size());
+                for (size_t i = 0; i < matches.size(); ++i) {
+                  Napi::Object match = Napi::Object::New(env);
+                  match.Set("index",
+                            Napi::Number::New(
+                                env, static_cast<double>(matches[i].index)));
+                  match.Set("similarity",
+                            Napi::Number::New(env, matches[i].similarity));
+                  result_array.Set(i, match);
+                }
+
+                return result_array;
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    index_obj.Set(
+        "deduplicate",
+        Napi::Function::New(
+            env, [index](const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 1 || !call[0].IsNumber()) {
+                  throw Napi::TypeError::New(
+                      env, "Expected similarity threshold as first argument");
+                }
+
+                const double threshold =
+                    call[0].As<Napi::Number>().DoubleValue();
+                auto groups = index->deduplicate(threshold);
+
+                Napi::Array result_array = Napi::Array::New(env,
+                                                            groups.size());
+                for (size_t i = 0; i < groups.size(); ++i) {
+                  Napi::Array group = Napi::Array::New(env, groups[i].size());
+                  for (size_t j = 0; j < groups[i].size(); ++j) {
+                    group.Set(j, Napi::Number::New(env, groups[i][j]));
+                  }
+                  result_array.Set(i, group);
+                }
+
+                return result_array;
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    index_obj.Set(
+        "estimateSimilarity",
+        Napi::Function::New(
+            env, [index](const Napi::CallbackInfo &call) -> Napi::Value {
+              Napi::Env env = call.Env();
+              try {
+                if (call.Length() < 2 || !call[0].IsNumber() ||
+                    !call[1].IsNumber()) {
+                  throw Napi::TypeError::New(
+                      env, "Expected 2 document indices");
+                }
+
+                const auto i = static_cast<size_t>(
+                    call[0].As<Napi::Number>().Uint32Value());
+                const auto j = static_cast<size_t>(
+                    call[1].As<Napi::Number>().Uint32Value());
+                if (i >= index->size() || j >= index->size()) {
+                  throw Napi::RangeError::New(env,
+                                              "Document index out of range");
+                }
+
+                return Napi::Number::New(env,
+                                         index->estimate_similarity(i, j));
+              } catch (const Napi::Error &e) {
+                e.ThrowAsJavaScriptException();
+                return env.Null();
+              } catch (const std::exception &e) {
+                Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+                return env.Null();
+              }
+            }));
+
+    return index_obj;
+
+  } catch (const Napi::Error &e) {
+    e.ThrowAsJavaScriptException();
+    return env.Null();
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::Deduplicate(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
 
-      std::string s1 = pair.Get(0u).As<Napi::String>().Utf8Value();
-      std::string s2 = pair.Get(1u).As<Napi::String>().Utf8Value();
-      pairs.emplace_back(std::move(s1), std::move(s2));
+  try {
+    if (info.Length() < 2 || !info[0].IsArray() || !info[1].IsNumber()) {
+      throw Napi::TypeError::New(
+          env, "Expected 2 arguments: strings array, similarity threshold");
     }
 
-    Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
-    if (info.Length() > 1) {
-      algorithm = ExtractAlgorithmType(info[1]);
+    Napi::Array strings_array = info[0].As<Napi::Array>();
+    std::vector<std::string> strings;
+    strings.reserve(strings_array.Length());
+    for (uint32_t i = 0; i < strings_array.Length(); ++i) {
+      Napi::Value entry = strings_array.Get(i);
+      if (!entry.IsString()) {
+        throw Napi::TypeError::New(env, "Each document must be a string");
+      }
+      strings.push_back(entry.As<Napi::String>().Utf8Value());
     }
 
+    const double threshold = info[1].As<Napi::Number>().DoubleValue();
+
     Core::AlgorithmConfig config{};
+    config.preprocessing = Core::PreprocessingMode::NGram;
     if (info.Length() > 2 && info[2].IsObject()) {
       config = ExtractConfig(info[2].As<Napi::Object>());
     }
 
-    auto results =
-        engine_->calculate_similarity_batch(pairs, algorithm, config);
+    LSH::MinHashIndex index(strings, config);
+    auto groups = index.deduplicate(threshold);
 
-    Napi::Array result_array = Napi::Array::New(env, results.size());
-    for (size_t i = 0; i < results.size(); ++i) {
-      result_array.Set(i, ResultToObject(env, results[i]));
+    Napi::Array result_array = Napi::Array::New(env, groups.size());
+    for (size_t i = 0; i < groups.size(); ++i) {
+      Napi::Array group = Napi::Array::New(env, groups[i].size());
+      for (size_t j = 0; j < groups[i].size(); ++j) {
+        group.Set(j, Napi::Number::New(env, groups[i][j]));
+      }
+      result_array.Set(i, group);
     }
 
     return result_array;
@@ -283,12 +1745,16 @@ TextSimilarityAddon::CalculateSimilarityAsync(const Napi::CallbackInfo &info) {
           env, "Expected at least 2 arguments: string1, string2");
     }
 
-    if (!ValidateStringInput(info[0]) || !ValidateStringInput(info[1])) {
-      throw Napi::TypeError::New(env, "Arguments must be strings");
+    if (!ValidateStringLikeInput(info[0]) || !ValidateStringLikeInput(info[1])) {
+      throw Napi::TypeError::New(env,
+                                 "Arguments must be strings or UTF-8 buffers");
     }
 
-    std::string s1 = info[0].As<Napi::String>().Utf8Value();
-    std::string s2 = info[1].As<Napi::String>().Utf8Value();
+    // The worker outlives this call, so it must own copies of the inputs;
+    // views into the stack-local storage would dangle before Execute() runs
+    std::string storage1, storage2;
+    std::string s1(ExtractStringView(info[0], storage1));
+    std::string s2(ExtractStringView(info[1], storage2));
 
     Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
     if (info.Length() > 2) {
@@ -301,8 +1767,9 @@ TextSimilarityAddon::CalculateSimilarityAsync(const Napi::CallbackInfo &info) {
     }
 
     auto worker = new AsyncWorker<Core::SimilarityResult>(
-        env, s1, s2, algorithm, config, [s1, s2, algorithm, config]() {
-          return engine_->calculate_similarity(s1, s2, algorithm, config);
+        env, std::move(s1), std::move(s2), algorithm, config,
+        [algorithm, config](const std::string &lhs, const std::string &rhs) {
+          return engine_->calculate_similarity(lhs, rhs, algorithm, config);
         });
 
     auto promise = worker->GetPromise();
@@ -331,12 +1798,16 @@ TextSimilarityAddon::CalculateDistanceAsync(const Napi::CallbackInfo &info) {
           env, "Expected at least 2 arguments: string1, string2");
     }
 
-    if (!ValidateStringInput(info[0]) || !ValidateStringInput(info[1])) {
-      throw Napi::TypeError::New(env, "Arguments must be strings");
+    if (!ValidateStringLikeInput(info[0]) || !ValidateStringLikeInput(info[1])) {
+      throw Napi::TypeError::New(env,
+                                 "Arguments must be strings or UTF-8 buffers");
     }
 
-    std::string s1 = info[0].As<Napi::String>().Utf8Value();
-    std::string s2 = info[1].As<Napi::String>().Utf8Value();
+    // The worker outlives this call, so it must own copies of the inputs;
+    // views into the stack-local storage would dangle before Execute() runs
+    std::string storage1, storage2;
+    std::string s1(ExtractStringView(info[0], storage1));
+    std::string s2(ExtractStringView(info[1], storage2));
 
     Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
     if (info.Length() > 2) {
@@ -349,8 +1820,9 @@ TextSimilarityAddon::CalculateDistanceAsync(const Napi::CallbackInfo &info) {
     }
 
     auto worker = new AsyncWorker<Core::DistanceResult>(
-        env, s1, s2, algorithm, config, [s1, s2, algorithm, config]() {
-          return engine_->calculate_distance(s1, s2, algorithm, config);
+        env, std::move(s1), std::move(s2), algorithm, config,
+        [algorithm, config](const std::string &lhs, const std::string &rhs) {
+          return engine_->calculate_distance(lhs, rhs, algorithm, config);
         });
 
     auto promise = worker->GetPromise();
@@ -406,12 +1878,89 @@ Napi::Value TextSimilarityAddon::CalculateSimilarityBatchAsync(
     }
 
     Core::AlgorithmConfig config{};
+    size_t concurrency = 0;
+    bool typed_array = false;
     if (info.Length() > 2 && info[2].IsObject()) {
-      config = ExtractConfig(info[2].As<Napi::Object>());
+      Napi::Object config_obj = info[2].As<Napi::Object>();
+      config = ExtractConfig(config_obj);
+      concurrency = ExtractConcurrency(config_obj);
+      typed_array = ExtractTypedArrayFormat(config_obj);
     }
 
     auto worker = new BatchAsyncWorker(env, std::move(pairs), algorithm, config,
-                                       engine_.get());
+                                       engine_.get(), concurrency, typed_array);
+    auto promise = worker->GetPromise();
+    worker->Queue();
+
+    return promise;
+
+  } catch (const Napi::Error &e) {
+    auto deferred = Napi::Promise::Deferred::New(env);
+    deferred.Reject(e.Value());
+    return deferred.Promise();
+  } catch (const std::exception &e) {
+    auto deferred = Napi::Promise::Deferred::New(env);
+    deferred.Reject(Napi::Error::New(env, e.what()).Value());
+    return deferred.Promise();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::CalculateOneToManyAsync(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    if (info.Length() < 2) {
+      throw Napi::TypeError::New(
+          env, "Expected at least 2 arguments: query, candidates");
+    }
+
+    if (!ValidateStringLikeInput(info[0])) {
+      throw Napi::TypeError::New(env, "Query must be a string or UTF-8 buffer");
+    }
+
+    if (!info[1].IsArray()) {
+      throw Napi::TypeError::New(
+          env, "Expected array of candidate strings as second argument");
+    }
+
+    std::string query_storage;
+    std::string query(ExtractStringView(info[0], query_storage));
+
+    Napi::Array candidates_array = info[1].As<Napi::Array>();
+    const size_t candidate_count = candidates_array.Length();
+
+    // The worker outlives this call, so it must own the candidate strings;
+    // buffer inputs are copied here rather than referenced
+    std::vector<std::string> candidates(candidate_count);
+
+    for (uint32_t i = 0; i < candidate_count; ++i) {
+      Napi::Value candidate = candidates_array.Get(i);
+      if (!ValidateStringLikeInput(candidate)) {
+        throw Napi::TypeError::New(
+            env, "Each candidate must be a string or UTF-8 buffer");
+      }
+      std::string_view view = ExtractStringView(candidate, candidates[i]);
+      if (view.data() != candidates[i].data()) {
+        candidates[i].assign(view);
+      }
+    }
+
+    Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein;
+    if (info.Length() > 2) {
+      algorithm = ExtractAlgorithmType(info[2]);
+    }
+
+    Core::AlgorithmConfig config{};
+    bool typed_array = false;
+    if (info.Length() > 3 && info[3].IsObject()) {
+      config = ExtractConfig(info[3].As<Napi::Object>());
+      typed_array = ExtractTypedArrayFormat(info[3].As<Napi::Object>());
+    }
+
+    auto worker =
+        new OneToManyAsyncWorker(env, std::move(query), std::move(candidates),
+                                 algorithm, config, engine_.get(), typed_array);
     auto promise = worker->GetPromise();
     worker->Queue();
 
@@ -507,6 +2056,203 @@ TextSimilarityAddon::GetMemoryUsage(const Napi::CallbackInfo &info) {
   }
 }
 
+Napi::Value
+TextSimilarityAddon::GetCacheStatistics(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    auto stats = engine_->get_cache_statistics();
+
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("hits", Napi::Number::New(env, static_cast<double>(stats.hits)));
+    obj.Set("misses",
+            Napi::Number::New(env, static_cast<double>(stats.misses)));
+    obj.Set("evictions",
+            Napi::Number::New(env, static_cast<double>(stats.evictions)));
+    obj.Set("entries",
+            Napi::Number::New(env, static_cast<double>(stats.entries)));
+    obj.Set("capacity",
+            Napi::Number::New(env, static_cast<double>(stats.capacity)));
+
+    return obj;
+
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::GetPrefilterStatistics(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    auto stats = engine_->get_prefilter_statistics();
+
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("considered",
+            Napi::Number::New(env, static_cast<double>(stats.considered)));
+    obj.Set("skipped",
+            Napi::Number::New(env, static_cast<double>(stats.skipped)));
+
+    return obj;
+
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::GetExecutorStatistics(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    auto stats = engine_->get_executor_statistics();
+
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("workerCount",
+            Napi::Number::New(env, static_cast<double>(stats.worker_count)));
+    obj.Set("pendingTasks",
+            Napi::Number::New(env, static_cast<double>(stats.pending_tasks)));
+    obj.Set("executedTasks",
+            Napi::Number::New(env, static_cast<double>(stats.executed_tasks)));
+    obj.Set("steals",
+            Napi::Number::New(env, static_cast<double>(stats.steals)));
+    obj.Set("taskWaitNs",
+            Napi::Number::New(env, static_cast<double>(stats.task_wait_ns)));
+
+    return obj;
+
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value TextSimilarityAddon::GetStatistics(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    Napi::Object obj = Napi::Object::New(env);
+
+    // Per-algorithm call counts and latency histograms; algorithms that
+    // have never run are omitted so the object stays small
+    auto metrics = Core::AlgorithmMetrics::aggregate();
+    Napi::Object algorithms = Napi::Object::New(env);
+    for (size_t i = 0; i < Core::AlgorithmMetrics::ALGORITHM_COUNT; ++i) {
+      if (metrics.calls[i] == 0) {
+        continue;
+      }
+
+      Napi::Object entry = Napi::Object::New(env);
+      entry.Set("calls",
+                Napi::Number::New(env, static_cast<double>(metrics.calls[i])));
+      entry.Set("totalTimeNs", Napi::Number::New(
+                                   env, static_cast<double>(
+                                            metrics.total_time_ns[i])));
+      entry.Set("avgTimeNs",
+                Napi::Number::New(env,
+                                  static_cast<double>(metrics.total_time_ns[i]) /
+                                      static_cast<double>(metrics.calls[i])));
+
+      Napi::Array histogram =
+          Napi::Array::New(env, Core::AlgorithmMetrics::BUCKET_COUNT);
+      for (size_t bucket = 0; bucket < Core::AlgorithmMetrics::BUCKET_COUNT;
+           ++bucket) {
+        histogram.Set(bucket,
+                      Napi::Number::New(env, static_cast<double>(
+                                                 metrics.latency_buckets
+                                                     [i][bucket])));
+      }
+      entry.Set("latencyHistogramNs", histogram);
+
+      algorithms.Set(
+          Core::get_algorithm_name(static_cast<Core::AlgorithmType>(i)), entry);
+    }
+    obj.Set("algorithms", algorithms);
+
+    auto cache_stats = engine_->get_cache_statistics();
+    Napi::Object cache = Napi::Object::New(env);
+    cache.Set("hits",
+              Napi::Number::New(env, static_cast<double>(cache_stats.hits)));
+    cache.Set("misses",
+              Napi::Number::New(env, static_cast<double>(cache_stats.misses)));
+    cache.Set("evictions", Napi::Number::New(env, static_cast<double>(
+                                                      cache_stats.evictions)));
+    cache.Set("entries",
+              Napi::Number::New(env, static_cast<double>(cache_stats.entries)));
+    size_t lookups = cache_stats.hits + cache_stats.misses;
+    cache.Set("hitRate",
+              Napi::Number::New(env, lookups > 0
+                                         ? static_cast<double>(cache_stats.hits) /
+                                               static_cast<double>(lookups)
+                                         : 0.0));
+    obj.Set("cache", cache);
+
+    auto prefilter_stats = engine_->get_prefilter_statistics();
+    Napi::Object prefilter = Napi::Object::New(env);
+    prefilter.Set("considered",
+                  Napi::Number::New(env, static_cast<double>(
+                                             prefilter_stats.considered)));
+    prefilter.Set("skipped", Napi::Number::New(env, static_cast<double>(
+                                                        prefilter_stats
+                                                            .skipped)));
+    obj.Set("prefilter", prefilter);
+
+    auto executor_stats = engine_->get_executor_statistics();
+    Napi::Object executor = Napi::Object::New(env);
+    executor.Set("workerCount",
+                 Napi::Number::New(env, static_cast<double>(
+                                            executor_stats.worker_count)));
+    executor.Set("pendingTasks",
+                 Napi::Number::New(env, static_cast<double>(
+                                            executor_stats.pending_tasks)));
+    executor.Set("executedTasks",
+                 Napi::Number::New(env, static_cast<double>(
+                                            executor_stats.executed_tasks)));
+    executor.Set("steals", Napi::Number::New(env, static_cast<double>(
+                                                      executor_stats.steals)));
+    executor.Set("taskWaitNs",
+                 Napi::Number::New(env, static_cast<double>(
+                                            executor_stats.task_wait_ns)));
+    obj.Set("executor", executor);
+
+    Napi::Object memory = Napi::Object::New(env);
+    memory.Set("engineBytes",
+               Napi::Number::New(
+                   env, static_cast<double>(engine_->get_memory_usage())));
+    memory.Set("arenaReservedBytes",
+               Napi::Number::New(env, static_cast<double>(
+                                          Core::BumpArena::reserved_bytes())));
+    memory.Set("arenaPeakBytes",
+               Napi::Number::New(
+                   env,
+                   static_cast<double>(Core::BumpArena::peak_reserved_bytes())));
+    obj.Set("memory", memory);
+
+    return obj;
+
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
+Napi::Value
+TextSimilarityAddon::ResetStatistics(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  try {
+    engine_->reset_statistics();
+    return env.Undefined();
+
+  } catch (const std::exception &e) {
+    Napi::Error::New(env, e.what()).ThrowAsJavaScriptException();
+    return env.Null();
+  }
+}
+
 Napi::Value TextSimilarityAddon::ClearCaches(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
 
@@ -538,6 +2284,27 @@ TextSimilarityAddon::ExtractAlgorithmType(const Napi::Value &value) {
   return Core::AlgorithmType::Levenshtein; // Default
 }
 
+size_t TextSimilarityAddon::ExtractConcurrency(const Napi::Object &config_obj) {
+  if (config_obj.Has("concurrency") &&
+      config_obj.Get("concurrency").IsNumber()) {
+    return static_cast<size_t>(
+        config_obj.Get("concurrency").As<Napi::Number>().Uint32Value());
+  }
+
+  return 0; // Use all available worker threads
+}
+
+bool TextSimilarityAddon::ExtractTypedArrayFormat(
+    const Napi::Object &config_obj) {
+  if (config_obj.Has("resultFormat") &&
+      config_obj.Get("resultFormat").IsString()) {
+    return config_obj.Get("resultFormat").As<Napi::String>().Utf8Value() ==
+           "typed-array";
+  }
+
+  return false;
+}
+
 Core::AlgorithmConfig
 TextSimilarityAddon::ExtractConfig(const Napi::Object &config_obj) {
   Core::AlgorithmConfig config{};
@@ -595,6 +2362,40 @@ TextSimilarityAddon::ExtractConfig(const Napi::Object &config_obj) {
         config_obj.Get("maxStringLength").As<Napi::Number>().Int64Value());
   }
 
+  if (config_obj.Has("cacheCapacity") &&
+      config_obj.Get("cacheCapacity").IsNumber()) {
+    config.cache_capacity = static_cast<size_t>(
+        config_obj.Get("cacheCapacity").As<Napi::Number>().Int64Value());
+  }
+
+  if (config_obj.Has("minhashPermutations") &&
+      config_obj.Get("minhashPermutations").IsNumber()) {
+    config.minhash_permutations =
+        config_obj.Get("minhashPermutations").As<Napi::Number>().Uint32Value();
+  }
+
+  if (config_obj.Has("lshBands") && config_obj.Get("lshBands").IsNumber()) {
+    config.lsh_bands =
+        config_obj.Get("lshBands").As<Napi::Number>().Uint32Value();
+  }
+
+  if (config_obj.Has("sharedCache") &&
+      config_obj.Get("sharedCache").IsBoolean()) {
+    config.shared_cache = config_obj.Get("sharedCache").As<Napi::Boolean>();
+  }
+
+  if (config_obj.Has("sharedCacheName") &&
+      config_obj.Get("sharedCacheName").IsString()) {
+    config.shared_cache_name =
+        config_obj.Get("sharedCacheName").As<Napi::String>().Utf8Value();
+  }
+
+  if (config_obj.Has("sharedCacheBytes") &&
+      config_obj.Get("sharedCacheBytes").IsNumber()) {
+    config.shared_cache_bytes = static_cast<size_t>(
+        config_obj.Get("sharedCacheBytes").As<Napi::Number>().Int64Value());
+  }
+
   return config;
 }
 
@@ -637,6 +2438,35 @@ TextSimilarityAddon::ConfigToObject(Napi::Env env,
         Napi::Number::New(env, static_cast<double>(*config.max_string_length)));
   }
 
+  if (config.cache_capacity.has_value()) {
+    obj.Set("cacheCapacity",
+            Napi::Number::New(env, static_cast<double>(*config.cache_capacity)));
+  }
+
+  if (config.minhash_permutations.has_value()) {
+    obj.Set("minhashPermutations",
+            Napi::Number::New(env, *config.minhash_permutations));
+  }
+
+  if (config.lsh_bands.has_value()) {
+    obj.Set("lshBands", Napi::Number::New(env, *config.lsh_bands));
+  }
+
+  if (config.shared_cache.has_value()) {
+    obj.Set("sharedCache", Napi::Boolean::New(env, *config.shared_cache));
+  }
+
+  if (config.shared_cache_name.has_value()) {
+    obj.Set("sharedCacheName",
+            Napi::String::New(env, *config.shared_cache_name));
+  }
+
+  if (config.shared_cache_bytes.has_value()) {
+    obj.Set("sharedCacheBytes",
+            Napi::Number::New(
+                env, static_cast<double>(*config.shared_cache_bytes)));
+  }
+
   return obj;
 }
 
@@ -672,10 +2502,65 @@ TextSimilarityAddon::ResultToObject(Napi::Env env,
   return obj;
 }
 
+Napi::Object TextSimilarityAddon::TypedResultsToObject(
+    Napi::Env env, const std::vector<Core::SimilarityResult> &results) {
+  auto scores = Napi::Float64Array::New(env, results.size());
+  double *data = scores.Data();
+
+  Napi::Array errors = Napi::Array::New(env);
+  uint32_t error_count = 0;
+
+  for (size_t i = 0; i < results.size(); ++i) {
+    if (results[i].is_success()) {
+      data[i] = results[i].value();
+    } else {
+      data[i] = std::numeric_limits<double>::quiet_NaN();
+
+      Napi::Object entry = Napi::Object::New(env);
+      entry.Set("index", Napi::Number::New(env, static_cast<double>(i)));
+      entry.Set("message",
+                Napi::String::New(env, results[i].error().message()));
+      errors.Set(error_count++, entry);
+    }
+  }
+
+  Napi::Object obj = Napi::Object::New(env);
+  obj.Set("scores", scores);
+  obj.Set("errors", errors);
+  return obj;
+}
+
 bool TextSimilarityAddon::ValidateStringInput(const Napi::Value &value) {
   return value.IsString();
 }
 
+bool TextSimilarityAddon::ValidateStringLikeInput(const Napi::Value &value) {
+  if (value.IsString() || value.IsBuffer()) {
+    return true;
+  }
+  return value.IsTypedArray() &&
+         value.As<Napi::TypedArray>().TypedArrayType() == napi_uint8_array;
+}
+
+std::string_view
+TextSimilarityAddon::ExtractStringView(const Napi::Value &value,
+                                       std::string &storage) {
+  if (value.IsBuffer()) {
+    auto buffer = value.As<Napi::Buffer<char>>();
+    return {buffer.Data(), buffer.Length()};
+  }
+
+  if (value.IsTypedArray() &&
+      value.As<Napi::TypedArray>().TypedArrayType() == napi_uint8_array) {
+    auto bytes = value.As<Napi::Uint8Array>();
+    return {reinterpret_cast<const char *>(bytes.Data()),
+            bytes.ByteLength()};
+  }
+
+  storage = value.As<Napi::String>().Utf8Value();
+  return storage;
+}
+
 bool TextSimilarityAddon::ValidateConfigInput(const Napi::Value &value) {
   return value.IsObject() || value.IsUndefined() || value.IsNull();
 }
@@ -696,7 +2581,23 @@ TextSimilarityAddon::CreateValidationError(Napi::Env env,
 
 void BatchAsyncWorker::Execute() {
   try {
-    results_ = engine_->calculate_similarity_batch(pairs_, algorithm_, config_);
+    results_ = engine_->calculate_similarity_batch(pairs_, algorithm_, config_,
+                                                   concurrency_);
+
+    if (typed_array_) {
+      // Scores land in the pre-allocated backing store here, off the main
+      // thread; only failure positions are kept for OnOK
+      for (size_t i = 0; i < results_.size(); ++i) {
+        if (results_[i].is_success()) {
+          scores_data_[i] = results_[i].value();
+        } else {
+          scores_data_[i] = std::numeric_limits<double>::quiet_NaN();
+          error_positions_.emplace_back(i, results_[i].error().message());
+        }
+      }
+      results_.clear();
+      results_.shrink_to_fit();
+    }
   } catch (const std::exception &e) {
     SetError(e.what());
   } catch (...) {
@@ -706,6 +2607,25 @@ void BatchAsyncWorker::Execute() {
 
 void BatchAsyncWorker::OnOK() {
   Napi::Env env = Env();
+
+  if (typed_array_) {
+    Napi::Array errors = Napi::Array::New(env, error_positions_.size());
+    for (size_t i = 0; i < error_positions_.size(); ++i) {
+      Napi::Object entry = Napi::Object::New(env);
+      entry.Set("index", Napi::Number::New(env, static_cast<double>(
+                                                    error_positions_[i].first)));
+      entry.Set("message",
+                Napi::String::New(env, error_positions_[i].second));
+      errors.Set(i, entry);
+    }
+
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("scores", scores_ref_.Value());
+    obj.Set("errors", errors);
+    deferred_.Resolve(obj);
+    return;
+  }
+
   Napi::Array result_array = Napi::Array::New(env, results_.size());
 
   for (size_t i = 0; i < results_.size(); ++i) {
@@ -724,6 +2644,126 @@ void BatchAsyncWorker::OnError(const Napi::Error &error) {
   deferred_.Reject(error.Value());
 }
 
+// OneToManyAsyncWorker implementation
+
+void OneToManyAsyncWorker::Execute() {
+  try {
+    // The worker owns the candidate strings; the engine takes views
+    std::vector<std::string_view> candidate_views(candidates_.begin(),
+                                                  candidates_.end());
+    results_ = engine_->calculate_one_to_many(query_, candidate_views,
+                                              algorithm_, config_);
+
+    if (typed_array_) {
+      for (size_t i = 0; i < results_.size(); ++i) {
+        if (results_[i].is_success()) {
+          scores_data_[i] = results_[i].value();
+        } else {
+          scores_data_[i] = std::numeric_limits<double>::quiet_NaN();
+          error_positions_.emplace_back(i, results_[i].error().message());
+        }
+      }
+      results_.clear();
+      results_.shrink_to_fit();
+    }
+  } catch (const std::exception &e) {
+    SetError(e.what());
+  } catch (...) {
+    SetError("Unknown error occurred in one-to-many processing");
+  }
+}
+
+void OneToManyAsyncWorker::OnOK() {
+  Napi::Env env = Env();
+
+  if (typed_array_) {
+    Napi::Array errors = Napi::Array::New(env, error_positions_.size());
+    for (size_t i = 0; i < error_positions_.size(); ++i) {
+      Napi::Object entry = Napi::Object::New(env);
+      entry.Set("index", Napi::Number::New(env, static_cast<double>(
+                                                    error_positions_[i].first)));
+      entry.Set("message",
+                Napi::String::New(env, error_positions_[i].second));
+      errors.Set(i, entry);
+    }
+
+    Napi::Object obj = Napi::Object::New(env);
+    obj.Set("scores", scores_ref_.Value());
+    obj.Set("errors", errors);
+    deferred_.Resolve(obj);
+    return;
+  }
+
+  Napi::Array result_array = Napi::Array::New(env, results_.size());
+
+  for (size_t i = 0; i < results_.size(); ++i) {
+    if (results_[i].is_success()) {
+      result_array.Set(i, Napi::Number::New(env, results_[i].value()));
+    } else {
+      auto error = TextSimilarityAddon::CreateError(env, results_[i].error());
+      result_array.Set(i, error.Value());
+    }
+  }
+
+  deferred_.Resolve(result_array);
+}
+
+void OneToManyAsyncWorker::OnError(const Napi::Error &error) {
+  deferred_.Reject(error.Value());
+}
+
+// TopKAsyncWorker implementation
+
+void TopKAsyncWorker::Execute() {
+  try {
+    matches_ = engine_->find_top_k(query_, candidates_, k_, min_similarity_,
+                                   algorithm_, config_);
+  } catch (const std::exception &e) {
+    SetError(e.what());
+  } catch (...) {
+    SetError("Unknown error occurred in top-k processing");
+  }
+}
+
+void TopKAsyncWorker::OnOK() {
+  Napi::Env env = Env();
+  Napi::Array result_array = Napi::Array::New(env, matches_.size());
+
+  for (size_t i = 0; i < matches_.size(); ++i) {
+    Napi::Object match = Napi::Object::New(env);
+    match.Set("index",
+              Napi::Number::New(env, static_cast<double>(matches_[i].index)));
+    match.Set("similarity", Napi::Number::New(env, matches_[i].similarity));
+    result_array.Set(i, match);
+  }
+
+  deferred_.Resolve(result_array);
+}
+
+void TopKAsyncWorker::OnError(const Napi::Error &error) {
+  deferred_.Reject(error.Value());
+}
+
+// MatrixAsyncWorker implementation
+
+void MatrixAsyncWorker::Execute() {
+  try {
+    auto matrix =
+        engine_->similarity_matrix(strings_, algorithm_, config_, concurrency_);
+    std::copy(matrix.begin(), matrix.end(), matrix_data_);
+  } catch (const std::exception &e) {
+    SetError(e.what());
+  } catch (...) {
+    SetError("Unknown error occurred in matrix processing");
+  }
+}
+
+void MatrixAsyncWorker::OnOK() { deferred_.Resolve(matrix_ref_.Value()); }
+
+void MatrixAsyncWorker::OnError(const Napi::Error &error) {
+  deferred_.Reject(error.Value());
+}
+
 // Utility function implementations
 
 Napi::Value
@@ -24,27 +24,77 @@ private:
   static Napi::Value CalculateSimilarity(const Napi::CallbackInfo &info);
   static Napi::Value CalculateDistance(const Napi::CallbackInfo &info);
   static Napi::Value CalculateSimilarityBatch(const Napi::CallbackInfo &info);
+  static Napi::Value CalculateOneToMany(const Napi::CallbackInfo &info);
+  static Napi::Value CalculateOneToManyPacked(const Napi::CallbackInfo &info);
+  static Napi::Value SimilarityMatrix(const Napi::CallbackInfo &info);
+  static Napi::Value FindTopK(const Napi::CallbackInfo &info);
+
+  // Session methods (long-lived algorithm instance per session)
+  static Napi::Value CreateSession(const Napi::CallbackInfo &info);
+
+  // Incremental matcher methods (append-aware autocomplete scoring)
+  static Napi::Value CreateIncrementalMatcher(const Napi::CallbackInfo &info);
+
+  // Cascade methods (staged cheap-to-expensive scoring in one native call)
+  static Napi::Value CreateCascade(const Napi::CallbackInfo &info);
+
+  // Profile methods (tokenize once, compare many times)
+  static Napi::Value CreateProfile(const Napi::CallbackInfo &info);
+
+  // Corpus index methods (persistent, memory-mapped)
+  static Napi::Value BuildIndex(const Napi::CallbackInfo &info);
+  static Napi::Value LoadIndex(const Napi::CallbackInfo &info);
+
+  // Inverted index methods (sub-linear fuzzy lookup)
+  static Napi::Value CreateInvertedIndex(const Napi::CallbackInfo &info);
+
+  // MinHash/LSH methods (approximate Jaccard at corpus scale)
+  static Napi::Value BuildSignatures(const Napi::CallbackInfo &info);
+  static Napi::Value Deduplicate(const Napi::CallbackInfo &info);
 
   // Asynchronous methods (Promise-based)
   static Napi::Value CalculateSimilarityAsync(const Napi::CallbackInfo &info);
   static Napi::Value CalculateDistanceAsync(const Napi::CallbackInfo &info);
   static Napi::Value
   CalculateSimilarityBatchAsync(const Napi::CallbackInfo &info);
+  static Napi::Value CalculateOneToManyAsync(const Napi::CallbackInfo &info);
+  static Napi::Value SimilarityMatrixAsync(const Napi::CallbackInfo &info);
+  static Napi::Value FindTopKAsync(const Napi::CallbackInfo &info);
 
   // Configuration methods
   static Napi::Value SetGlobalConfiguration(const Napi::CallbackInfo &info);
   static Napi::Value GetGlobalConfiguration(const Napi::CallbackInfo &info);
   static Napi::Value GetSupportedAlgorithms(const Napi::CallbackInfo &info);
   static Napi::Value GetMemoryUsage(const Napi::CallbackInfo &info);
+  static Napi::Value GetCacheStatistics(const Napi::CallbackInfo &info);
+  static Napi::Value GetPrefilterStatistics(const Napi::CallbackInfo &info);
+  static Napi::Value GetExecutorStatistics(const Napi::CallbackInfo &info);
+  static Napi::Value GetStatistics(const Napi::CallbackInfo &info);
+  static Napi::Value ResetStatistics(const Napi::CallbackInfo &info);
   static Napi::Value ClearCaches(const Napi::CallbackInfo &info);
 
   // Utility methods
   static Napi::Value ParseAlgorithmType(const Napi::CallbackInfo &info);
   static Napi::Value GetAlgorithmName(const Napi::CallbackInfo &info);
 
+  // Parsed findTopK / findTopKAsync arguments:
+  // (query, candidates[], k, minSimilarity?, algorithm?, config?)
+  struct TopKArguments {
+    std::string query;
+    std::vector<std::string> candidates;
+    size_t k{0};
+    double min_similarity{0.0};
+    Core::AlgorithmType algorithm{Core::AlgorithmType::Levenshtein};
+    Core::AlgorithmConfig config{};
+  };
+
+  static TopKArguments ParseTopKArguments(const Napi::CallbackInfo &info);
+
   // Helper functions for type conversion
   static Core::AlgorithmType ExtractAlgorithmType(const Napi::Value &value);
   static Core::AlgorithmConfig ExtractConfig(const Napi::Object &config_obj);
+  static size_t ExtractConcurrency(const Napi::Object &config_obj);
+  static bool ExtractTypedArrayFormat(const Napi::Object &config_obj);
   static Napi::Object ConfigToObject(Napi::Env env,
                                      const Core::AlgorithmConfig &config);
   static Napi::Object ResultToObject(Napi::Env env,
@@ -52,10 +102,25 @@ private:
   static Napi::Object ResultToObject(Napi::Env env,
                                      const Core::DistanceResult &result);
 
+  // Typed-array result mode ({ resultFormat: 'typed-array' }): scores land
+  // in one Float64Array (NaN at failed positions) and failures are listed
+  // sparsely as { index, message }, so a large batch materializes two JS
+  // values instead of one object per element
+  static Napi::Object TypedResultsToObject(
+      Napi::Env env, const std::vector<Core::SimilarityResult> &results);
+
   // Input validation
   static bool ValidateStringInput(const Napi::Value &value);
+  static bool ValidateStringLikeInput(const Napi::Value &value);
   static bool ValidateConfigInput(const Napi::Value &value);
 
+  // Zero-copy view over a JS string, Buffer, or Uint8Array (UTF-8 bytes).
+  // Buffers are referenced in place; strings are materialized into the
+  // caller-provided storage. The view is only valid while the JS value and
+  // the storage stay alive.
+  static std::string_view ExtractStringView(const Napi::Value &value,
+                                            std::string &storage);
+
 public:
   // Error creation helpers
   static Napi::Error CreateError(Napi::Env env,
@@ -64,12 +129,18 @@ public:
                                            const std::string &message);
 };
 
-// Async worker for Promise-based operations
+// Async worker for Promise-based operations. The worker owns copies of both
+// input strings — Execute() runs on a worker thread after the binding call
+// has returned, so the work function receives the owned members rather than
+// capturing views into the caller's stack.
 template <typename ResultType> class AsyncWorker : public Napi::AsyncWorker {
 public:
+  using WorkFunc =
+      std::function<ResultType(const std::string &, const std::string &)>;
+
   AsyncWorker(Napi::Env env, std::string s1, std::string s2,
               Core::AlgorithmType algorithm, Core::AlgorithmConfig config,
-              std::function<ResultType()> work_func)
+              WorkFunc work_func)
       : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)),
         s1_(std::move(s1)), s2_(std::move(s2)), algorithm_(algorithm),
         config_(std::move(config)), work_func_(std::move(work_func)) {}
@@ -81,7 +152,7 @@ public:
 protected:
   void Execute() override {
     try {
-      result_ = work_func_();
+      result_ = work_func_(s1_, s2_);
     } catch (const std::exception &e) {
       SetError(e.what());
     } catch (...) {
@@ -118,20 +189,34 @@ private:
   std::string s1_, s2_;
   Core::AlgorithmType algorithm_;
   Core::AlgorithmConfig config_;
-  std::function<ResultType()> work_func_;
+  WorkFunc work_func_;
   ResultType result_;
 };
 
 // Batch async worker
+//
+// In typed-array mode the Float64Array is allocated up front on the main
+// thread and its backing store is filled from the worker thread (ArrayBuffer
+// storage is stable heap memory), so OnOK only hands over the already-built
+// value plus a sparse error list instead of materializing one JS object per
+// result.
 class BatchAsyncWorker : public Napi::AsyncWorker {
 public:
   BatchAsyncWorker(Napi::Env env,
                    std::vector<std::pair<std::string, std::string>> pairs,
                    Core::AlgorithmType algorithm, Core::AlgorithmConfig config,
-                   Core::ISimilarityEngine *engine)
+                   Core::ISimilarityEngine *engine, size_t concurrency = 0,
+                   bool typed_array = false)
       : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)),
         pairs_(std::move(pairs)), algorithm_(algorithm),
-        config_(std::move(config)), engine_(engine) {}
+        config_(std::move(config)), engine_(engine), concurrency_(concurrency),
+        typed_array_(typed_array) {
+    if (typed_array_) {
+      auto scores = Napi::Float64Array::New(env, pairs_.size());
+      scores_data_ = scores.Data();
+      scores_ref_ = Napi::Persistent(scores.As<Napi::Value>());
+    }
+  }
 
   Napi::Promise GetPromise() { return deferred_.Promise(); }
 
@@ -146,7 +231,120 @@ private:
   Core::AlgorithmType algorithm_;
   Core::AlgorithmConfig config_;
   Core::ISimilarityEngine *engine_;
+  size_t concurrency_;
+  bool typed_array_;
+  double *scores_data_{nullptr};
+  Napi::Reference<Napi::Value> scores_ref_;
+  std::vector<std::pair<size_t, std::string>> error_positions_;
+  std::vector<Core::SimilarityResult> results_;
+};
+
+// One-to-many async worker (same typed-array contract as BatchAsyncWorker)
+class OneToManyAsyncWorker : public Napi::AsyncWorker {
+public:
+  OneToManyAsyncWorker(Napi::Env env, std::string query,
+                       std::vector<std::string> candidates,
+                       Core::AlgorithmType algorithm,
+                       Core::AlgorithmConfig config,
+                       Core::ISimilarityEngine *engine,
+                       bool typed_array = false)
+      : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)),
+        query_(std::move(query)), candidates_(std::move(candidates)),
+        algorithm_(algorithm), config_(std::move(config)), engine_(engine),
+        typed_array_(typed_array) {
+    if (typed_array_) {
+      auto scores = Napi::Float64Array::New(env, candidates_.size());
+      scores_data_ = scores.Data();
+      scores_ref_ = Napi::Persistent(scores.As<Napi::Value>());
+    }
+  }
+
+  Napi::Promise GetPromise() { return deferred_.Promise(); }
+
+protected:
+  void Execute() override;
+  void OnOK() override;
+  void OnError(const Napi::Error &error) override;
+
+private:
+  Napi::Promise::Deferred deferred_;
+  std::string query_;
+  std::vector<std::string> candidates_;
+  Core::AlgorithmType algorithm_;
+  Core::AlgorithmConfig config_;
+  Core::ISimilarityEngine *engine_;
+  bool typed_array_;
+  double *scores_data_{nullptr};
+  Napi::Reference<Napi::Value> scores_ref_;
+  std::vector<std::pair<size_t, std::string>> error_positions_;
   std::vector<Core::SimilarityResult> results_;
 };
 
+// Top-K async worker (resolves to an array of {index, similarity} objects)
+class TopKAsyncWorker : public Napi::AsyncWorker {
+public:
+  TopKAsyncWorker(Napi::Env env, std::string query,
+                  std::vector<std::string> candidates, size_t k,
+                  double min_similarity, Core::AlgorithmType algorithm,
+                  Core::AlgorithmConfig config,
+                  Core::ISimilarityEngine *engine)
+      : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)),
+        query_(std::move(query)), candidates_(std::move(candidates)), k_(k),
+        min_similarity_(min_similarity), algorithm_(algorithm),
+        config_(std::move(config)), engine_(engine) {}
+
+  Napi::Promise GetPromise() { return deferred_.Promise(); }
+
+protected:
+  void Execute() override;
+  void OnOK() override;
+  void OnError(const Napi::Error &error) override;
+
+private:
+  Napi::Promise::Deferred deferred_;
+  std::string query_;
+  std::vector<std::string> candidates_;
+  size_t k_;
+  double min_similarity_;
+  Core::AlgorithmType algorithm_;
+  Core::AlgorithmConfig config_;
+  Core::ISimilarityEngine *engine_;
+  std::vector<Core::TopKMatch> matches_;
+};
+
+// Similarity matrix async worker (resolves to a Float64Array). The n*n
+// array is allocated up front and its backing store filled off-thread, so
+// OnOK resolves in O(1) without copying the matrix on the main thread.
+class MatrixAsyncWorker : public Napi::AsyncWorker {
+public:
+  MatrixAsyncWorker(Napi::Env env, std::vector<std::string> strings,
+                    Core::AlgorithmType algorithm, Core::AlgorithmConfig config,
+                    Core::ISimilarityEngine *engine, size_t concurrency = 0)
+      : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)),
+        strings_(std::move(strings)), algorithm_(algorithm),
+        config_(std::move(config)), engine_(engine),
+        concurrency_(concurrency) {
+    auto matrix = Napi::Float64Array::New(env, strings_.size() * strings_.size());
+    matrix_data_ = matrix.Data();
+    matrix_ref_ = Napi::Persistent(matrix.As<Napi::Value>());
+  }
+
+  Napi::Promise GetPromise() { return deferred_.Promise(); }
+
+protected:
+  void Execute() override;
+  void OnOK() override;
+  void OnError(const Napi::Error &error) override;
+
+private:
+  Napi::Promise::Deferred deferred_;
+  std::vector<std::string> strings_;
+  Core::AlgorithmType algorithm_;
+  Core::AlgorithmConfig config_;
+  Core::ISimilarityEngine *engine_;
+  size_t concurrency_;
+  double *matrix_data_{nullptr};
+  Napi::Reference<Napi::Value> matrix_ref_;
+};
+
 } // namespace TextSimilarity::Bindings
\ No newline at end of file
@@ -1,11 +1,24 @@
 #pragma once
 
 #include "types.hpp"
+#include <cstddef>
 #include <memory>
 #include <shared_mutex>
+#include <string_view>
+
+namespace TextSimilarity::Index {
+class CorpusIndex;
+} // namespace TextSimilarity::Index
 
 namespace TextSimilarity::Core {
 
+// Opaque precomputed representation of a query string, used to amortize
+// preprocessing costs when comparing one query against many candidates
+class IPreparedQuery {
+public:
+  virtual ~IPreparedQuery() = default;
+};
+
 // Base interface for all similarity algorithms
 class ISimilarityAlgorithm {
 public:
@@ -20,6 +33,29 @@ public:
   calculate_distance(const UnicodeString &s1,
                      const UnicodeString &s2) const = 0;
 
+  // One-to-many support: preprocess the query exactly once, then reuse the
+  // prepared form for every candidate comparison
+  [[nodiscard]] virtual std::unique_ptr<IPreparedQuery>
+  prepare_query(const UnicodeString &query) const = 0;
+
+  [[nodiscard]] virtual SimilarityResult
+  calculate_similarity_prepared(const IPreparedQuery &prepared,
+                                const UnicodeString &candidate) const = 0;
+
+  // Profile-vs-profile support: both sides carry precomputed state, so
+  // token and vector algorithms skip tokenization entirely
+  [[nodiscard]] virtual SimilarityResult
+  calculate_similarity_profiles(const IPreparedQuery &profile1,
+                                const IPreparedQuery &profile2) const = 0;
+
+  // Rebuild a prepared form around externally stored state (corpus index).
+  // The string must already be preprocessed for this algorithm's
+  // configuration, and the state must match what prepare_query would have
+  // produced for it.
+  [[nodiscard]] virtual std::unique_ptr<IPreparedQuery>
+  adopt_prepared_state(UnicodeString processed,
+                       std::shared_ptr<void> state) const = 0;
+
   [[nodiscard]] virtual AlgorithmType get_algorithm_type() const noexcept = 0;
   [[nodiscard]] virtual std::string get_algorithm_name() const noexcept = 0;
 
@@ -117,6 +153,19 @@ public:
   calculate_distance_async(std::unique_ptr<ISimilarityAlgorithm> algorithm,
                            UnicodeString s1, UnicodeString s2) = 0;
 
+  // Generic task submission for work that manages its own results
+  virtual void submit(std::function<void()> task) = 0;
+
+  // Enqueue a group of tasks with one synchronization per worker queue
+  // instead of one per task
+  virtual void submit_batch(std::vector<std::function<void()>> tasks) = 0;
+
+  [[nodiscard]] virtual ExecutorStatistics
+  get_statistics() const noexcept = 0;
+
+  // Zeroes the cumulative counters; live queue depth is unaffected
+  virtual void reset_statistics() noexcept = 0;
+
   virtual void shutdown() noexcept = 0;
 };
 
@@ -170,19 +219,110 @@ private:
                           std::function<std::shared_ptr<void>()> factory) = 0;
 };
 
+// Long-lived similarity session bound to a single algorithm instance.
+// Factory allocation and configuration merging are paid once at creation
+// instead of on every call.
+class ISimilaritySession {
+public:
+  virtual ~ISimilaritySession() = default;
+
+  [[nodiscard]] virtual SimilarityResult
+  calculate_similarity(const std::string &s1, const std::string &s2) = 0;
+
+  [[nodiscard]] virtual DistanceResult
+  calculate_distance(const std::string &s1, const std::string &s2) = 0;
+
+  [[nodiscard]] virtual AlgorithmType get_algorithm_type() const noexcept = 0;
+  [[nodiscard]] virtual AlgorithmConfig get_configuration() const = 0;
+};
+
+// Precomputed profile of one document bound to a single algorithm
+// instance. Normalization, tokenization and frequency-vector construction
+// are paid once at creation; comparisons against other profiles reuse the
+// precomputed state on both sides, and comparisons against raw text reuse
+// it on the profile side.
+class IDocumentProfile {
+public:
+  virtual ~IDocumentProfile() = default;
+
+  // Compare against another profile. Both profiles must have been created
+  // for the same algorithm type.
+  [[nodiscard]] virtual SimilarityResult
+  similarity_to(const IDocumentProfile &other) const = 0;
+
+  // Compare against raw text (the text side is tokenized per call)
+  [[nodiscard]] virtual SimilarityResult
+  similarity_to_text(const std::string &text) const = 0;
+
+  [[nodiscard]] virtual AlgorithmType get_algorithm_type() const noexcept = 0;
+  [[nodiscard]] virtual AlgorithmConfig get_configuration() const = 0;
+};
+
+// Append-aware matcher for autocomplete-style workloads. The candidate
+// set is fixed at creation; every candidate retains its DP rows against
+// the current query, so a query that extends the previous one ("ca" ->
+// "cat") only computes the appended rows, and any other edit rewinds to
+// the longest common prefix instead of restarting.
+class IIncrementalMatcher {
+public:
+  virtual ~IIncrementalMatcher() = default;
+
+  // Rescore all candidates against the new query, reusing retained DP
+  // rows for its common prefix with the previous query. Returns up to k
+  // matches with similarity >= min_similarity, best first.
+  [[nodiscard]] virtual std::vector<TopKMatch>
+  update(std::string_view query, size_t k, double min_similarity) = 0;
+
+  // Drop all retained rows; the candidate set stays
+  virtual void reset() = 0;
+
+  [[nodiscard]] virtual size_t candidate_count() const noexcept = 0;
+  [[nodiscard]] virtual AlgorithmType get_algorithm_type() const noexcept = 0;
+};
+
+// Multi-stage scoring pipeline. Stages run in order inside one native
+// call; a pair stops at the first stage whose score falls below that
+// stage's cutoff, so a cheap screening metric filters most pairs before
+// an expensive confirmation metric ever runs. Input strings are converted
+// once and shared across stages.
+class ICascade {
+public:
+  virtual ~ICascade() = default;
+
+  // Run one pair through the stages. The outcome carries the last stage
+  // that ran and its score, whether the pair passed or was cut
+  [[nodiscard]] virtual CascadeResult evaluate(std::string_view s1,
+                                               std::string_view s2) const = 0;
+
+  [[nodiscard]] virtual std::vector<CascadeResult> evaluate_batch(
+      const std::vector<std::pair<std::string, std::string>> &pairs) const = 0;
+
+  // One query against a candidate set: each stage scores only the
+  // survivors of the previous one, with the query prepared once per
+  // stage. Returns candidates that passed every stage with their final
+  // scores, best first
+  [[nodiscard]] virtual std::vector<TopKMatch>
+  match(std::string_view query,
+        const std::vector<std::string_view> &candidates) const = 0;
+
+  [[nodiscard]] virtual size_t stage_count() const noexcept = 0;
+};
+
 // Main similarity engine interface
 class ISimilarityEngine {
 public:
   virtual ~ISimilarityEngine() = default;
 
-  // Synchronous operations
+  // Synchronous operations. Inputs are UTF-8 views so callers holding
+  // externally owned bytes (e.g. N-API buffers) avoid intermediate copies;
+  // the engine copies once into its own UnicodeString.
   [[nodiscard]] virtual SimilarityResult
-  calculate_similarity(const std::string &s1, const std::string &s2,
+  calculate_similarity(std::string_view s1, std::string_view s2,
                        AlgorithmType algorithm = AlgorithmType::Levenshtein,
                        const AlgorithmConfig &config = {}) = 0;
 
   [[nodiscard]] virtual DistanceResult
-  calculate_distance(const std::string &s1, const std::string &s2,
+  calculate_distance(std::string_view s1, std::string_view s2,
                      AlgorithmType algorithm = AlgorithmType::Levenshtein,
                      const AlgorithmConfig &config = {}) = 0;
 
@@ -197,11 +337,79 @@ public:
                            AlgorithmType algorithm = AlgorithmType::Levenshtein,
                            AlgorithmConfig config = {}) = 0;
 
-  // Batch operations
+  // Batch operations (concurrency = 0 uses all available worker threads)
   [[nodiscard]] virtual std::vector<SimilarityResult>
   calculate_similarity_batch(
       const std::vector<std::pair<std::string, std::string>> &pairs,
       AlgorithmType algorithm = AlgorithmType::Levenshtein,
+      const AlgorithmConfig &config = {}, size_t concurrency = 0) = 0;
+
+  // One-to-many operations (single query against a candidate set; the query
+  // is converted and preprocessed exactly once). Candidates are UTF-8 views
+  // so a packed corpus buffer can be scored without per-string copies.
+  [[nodiscard]] virtual std::vector<SimilarityResult> calculate_one_to_many(
+      std::string_view query, const std::vector<std::string_view> &candidates,
+      AlgorithmType algorithm = AlgorithmType::Levenshtein,
+      const AlgorithmConfig &config = {}) = 0;
+
+  // Top-K nearest candidates, best first. The running Kth-best score is
+  // converted into a distance bound for algorithms that support early
+  // termination, so most candidates bail out after a few DP rows.
+  [[nodiscard]] virtual std::vector<TopKMatch>
+  find_top_k(const std::string &query,
+             const std::vector<std::string> &candidates, size_t k,
+             double min_similarity = 0.0,
+             AlgorithmType algorithm = AlgorithmType::Levenshtein,
+             const AlgorithmConfig &config = {}) = 0;
+
+  // All-pairs similarity over one corpus. Returns a dense row-major n*n
+  // matrix; failed cells hold NaN. Only the upper triangle is computed for
+  // symmetric algorithms and mirrored into the lower one.
+  [[nodiscard]] virtual std::vector<double>
+  similarity_matrix(const std::vector<std::string> &strings,
+                    AlgorithmType algorithm = AlgorithmType::Levenshtein,
+                    const AlgorithmConfig &config = {},
+                    size_t concurrency = 0) = 0;
+
+  // Session management (reusable algorithm instance per session)
+  [[nodiscard]] virtual std::unique_ptr<ISimilaritySession>
+  create_session(AlgorithmType algorithm,
+                 const AlgorithmConfig &config = {}) = 0;
+
+  // Profile management (tokenize once, compare many times)
+  [[nodiscard]] virtual std::unique_ptr<IDocumentProfile>
+  create_profile(std::string_view text,
+                 AlgorithmType algorithm = AlgorithmType::Levenshtein,
+                 const AlgorithmConfig &config = {}) = 0;
+
+  // Incremental matching (per-candidate DP rows persist across update
+  // calls, so append-only query changes cost only the appended rows).
+  // Only edit-distance algorithms are supported; anything else throws.
+  [[nodiscard]] virtual std::unique_ptr<IIncrementalMatcher>
+  create_incremental_matcher(std::vector<std::string> candidates,
+                             AlgorithmType algorithm = AlgorithmType::Levenshtein,
+                             const AlgorithmConfig &config = {}) = 0;
+
+  // Cascade scoring (cheap screening stages chained into expensive
+  // confirmation stages; see ICascade). Throws when stages is empty.
+  [[nodiscard]] virtual std::unique_ptr<ICascade>
+  create_cascade(std::vector<CascadeStage> stages) = 0;
+
+  // Queries against a persistent corpus index. The index's stored
+  // preprocessing snapshot overrides the corresponding fields of the
+  // passed configuration, since the indexed fingerprints were built with
+  // it. Token algorithms score straight from the mapped fingerprints;
+  // other algorithms use the stored preprocessed text.
+  [[nodiscard]] virtual std::vector<SimilarityResult>
+  calculate_one_to_many_indexed(
+      std::string_view query, const Index::CorpusIndex &index,
+      AlgorithmType algorithm = AlgorithmType::Levenshtein,
+      const AlgorithmConfig &config = {}) = 0;
+
+  [[nodiscard]] virtual std::vector<TopKMatch> find_top_k_indexed(
+      std::string_view query, const Index::CorpusIndex &index, size_t k,
+      double min_similarity = 0.0,
+      AlgorithmType algorithm = AlgorithmType::Levenshtein,
       const AlgorithmConfig &config = {}) = 0;
 
   // Configuration management
@@ -216,6 +424,15 @@ public:
 
   // Performance and diagnostics
   [[nodiscard]] virtual size_t get_memory_usage() const noexcept = 0;
+  [[nodiscard]] virtual CacheStatistics
+  get_cache_statistics() const noexcept = 0;
+  [[nodiscard]] virtual PrefilterStatistics
+  get_prefilter_statistics() const noexcept = 0;
+  [[nodiscard]] virtual ExecutorStatistics
+  get_executor_statistics() const noexcept = 0;
+  // Zeroes all cumulative statistics (operation counts, cache and
+  // prefilter counters, executor totals, per-algorithm histograms)
+  virtual void reset_statistics() noexcept = 0;
   virtual void clear_caches() noexcept = 0;
   virtual void shutdown() noexcept = 0;
 };
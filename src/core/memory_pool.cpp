@@ -238,6 +238,133 @@ void ThreadLocalMemoryPool::reset_all() noexcept {
                    all_pools_.end());
 }
 
+// BumpArena Implementation
+
+BumpArena::Block::Block(size_t block_size)
+    : memory(new char[block_size]), size(block_size), offset(0) {}
+
+void *BumpArena::Block::allocate(size_t alloc_size,
+                                 size_t alignment) noexcept {
+  // new char[] is aligned for max_align_t, so aligning the offset aligns
+  // the pointer
+  size_t aligned_offset = (offset + alignment - 1) & ~(alignment - 1);
+
+  if (aligned_offset + alloc_size > size) {
+    return nullptr;
+  }
+
+  void *ptr = memory.get() + aligned_offset;
+  offset = aligned_offset + alloc_size;
+
+  return ptr;
+}
+
+std::atomic<size_t> BumpArena::total_reserved_{0};
+std::atomic<size_t> BumpArena::peak_reserved_{0};
+
+BumpArena::BumpArena(size_t block_size) : default_block_size_(block_size) {
+  if (block_size == 0) {
+    throw std::invalid_argument("Block size must be greater than 0");
+  }
+}
+
+BumpArena::~BumpArena() {
+  size_t released = 0;
+  for (const Block &block : blocks_) {
+    released += block.size;
+  }
+  total_reserved_.fetch_sub(released, std::memory_order_relaxed);
+}
+
+void *BumpArena::allocate(size_t size, size_t alignment) {
+  if (size == 0) {
+    return nullptr;
+  }
+
+  if (alignment == 0) {
+    alignment = alignof(std::max_align_t);
+  }
+
+  if ((alignment & (alignment - 1)) != 0 ||
+      alignment > alignof(std::max_align_t)) {
+    throw std::invalid_argument(
+        "Alignment must be a power of 2 no stricter than max_align_t");
+  }
+
+  while (true) {
+    if (current_ < blocks_.size()) {
+      if (void *ptr = blocks_[current_].allocate(size, alignment)) {
+        return ptr;
+      }
+
+      // The current block is full; blocks left over from before a rewind
+      // are reused from the start before any new block is added
+      ++current_;
+      if (current_ < blocks_.size()) {
+        blocks_[current_].offset = 0;
+        continue;
+      }
+    }
+
+    size_t block_size = std::max(default_block_size_, size + alignment);
+    blocks_.emplace_back(block_size);
+    current_ = blocks_.size() - 1;
+    record_reservation(block_size);
+  }
+}
+
+void BumpArena::deallocate(void *ptr, size_t size) noexcept {
+  // Memory is reclaimed on rewind() or reset()
+  (void)ptr;
+  (void)size;
+}
+
+void BumpArena::reset() noexcept {
+  current_ = 0;
+  if (!blocks_.empty()) {
+    blocks_[0].offset = 0;
+  }
+}
+
+BumpArena::Marker BumpArena::mark() const noexcept {
+  if (blocks_.empty()) {
+    return Marker{0, 0};
+  }
+  return Marker{current_, blocks_[current_].offset};
+}
+
+void BumpArena::rewind(Marker marker) noexcept {
+  if (blocks_.empty()) {
+    return;
+  }
+  current_ = std::min(marker.block, blocks_.size() - 1);
+  blocks_[current_].offset = marker.offset;
+}
+
+size_t BumpArena::reserved_bytes() noexcept {
+  return total_reserved_.load(std::memory_order_relaxed);
+}
+
+size_t BumpArena::peak_reserved_bytes() noexcept {
+  return peak_reserved_.load(std::memory_order_relaxed);
+}
+
+void BumpArena::record_reservation(size_t block_size) noexcept {
+  size_t reserved =
+      total_reserved_.fetch_add(block_size, std::memory_order_relaxed) +
+      block_size;
+  size_t peak = peak_reserved_.load(std::memory_order_relaxed);
+  while (reserved > peak && !peak_reserved_.compare_exchange_weak(
+                                peak, reserved, std::memory_order_relaxed)) {
+  }
+}
+
+const std::shared_ptr<BumpArena> &thread_arena() {
+  thread_local std::shared_ptr<BumpArena> arena =
+      std::make_shared<BumpArena>();
+  return arena;
+}
+
 // Factory Functions
 
 std::unique_ptr<IMemoryPool> create_memory_pool(size_t initial_size) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "interfaces.hpp"
+#include <atomic>
 #include <cstdlib>
 #include <memory>
 #include <mutex>
@@ -76,6 +77,69 @@ private:
   static std::vector<std::weak_ptr<MemoryPool>> all_pools_;
 };
 
+// Unsynchronized bump arena for per-call scratch memory.
+//
+// Allocation is a pointer bump into the current block and individual
+// deallocation is a no-op; memory is reclaimed by rewinding to a marker
+// (see ArenaScope) or by reset(). Deliberately not thread-safe: every
+// thread owns its own arena via thread_arena(), so the hot path never
+// takes a lock.
+class BumpArena final : public IMemoryPool {
+public:
+  explicit BumpArena(size_t block_size = 256 * 1024); // 256KB default
+  ~BumpArena() override;
+
+  // Non-copyable, non-movable (blocks are referenced by live allocations)
+  BumpArena(const BumpArena &) = delete;
+  BumpArena &operator=(const BumpArena &) = delete;
+  BumpArena(BumpArena &&) = delete;
+  BumpArena &operator=(BumpArena &&) = delete;
+
+  [[nodiscard]] void *
+  allocate(size_t size, size_t alignment = alignof(std::max_align_t)) override;
+  void deallocate(void *ptr, size_t size) noexcept override;
+  void reset() noexcept override;
+
+  // Position in the arena; rewinding to a marker frees everything
+  // allocated after the marker was taken, keeping earlier allocations alive
+  struct Marker {
+    size_t block;
+    size_t offset;
+  };
+
+  [[nodiscard]] Marker mark() const noexcept;
+  void rewind(Marker marker) noexcept;
+
+  // Process-wide block reservation counters across all arenas, for
+  // diagnostics; rewinding does not release blocks, so "reserved" tracks
+  // the high-water footprint of scratch memory rather than live usage
+  [[nodiscard]] static size_t reserved_bytes() noexcept;
+  [[nodiscard]] static size_t peak_reserved_bytes() noexcept;
+
+private:
+  struct Block {
+    std::unique_ptr<char[]> memory;
+    size_t size;
+    size_t offset;
+
+    explicit Block(size_t block_size);
+    [[nodiscard]] void *allocate(size_t size, size_t alignment) noexcept;
+  };
+
+  std::vector<Block> blocks_;
+  size_t current_{0};
+  size_t default_block_size_;
+
+  static std::atomic<size_t> total_reserved_;
+  static std::atomic<size_t> peak_reserved_;
+
+  void record_reservation(size_t block_size) noexcept;
+};
+
+// Arena shared by all scratch allocations on the calling thread. The
+// shared_ptr keeps the arena alive for allocators that outlive the thread.
+[[nodiscard]] const std::shared_ptr<BumpArena> &thread_arena();
+
 // RAII wrapper for scoped memory management
 template <typename T> class ScopedPoolAllocator {
 public:
@@ -134,6 +198,30 @@ public:
   std::shared_ptr<IMemoryPool> pool_;
 };
 
+// RAII comparison scope over the thread arena: takes a marker on entry and
+// rewinds on exit, so each comparison releases exactly its own scratch and
+// nested scopes compose. Containers built from allocator() must not
+// outlive the scope.
+class ArenaScope final {
+public:
+  ArenaScope() : arena_(thread_arena()), marker_(arena_->mark()) {}
+  ~ArenaScope() { arena_->rewind(marker_); }
+
+  ArenaScope(const ArenaScope &) = delete;
+  ArenaScope &operator=(const ArenaScope &) = delete;
+  ArenaScope(ArenaScope &&) = delete;
+  ArenaScope &operator=(ArenaScope &&) = delete;
+
+  template <typename T>
+  [[nodiscard]] ScopedPoolAllocator<T> allocator() const {
+    return ScopedPoolAllocator<T>(arena_);
+  }
+
+private:
+  std::shared_ptr<BumpArena> arena_;
+  BumpArena::Marker marker_;
+};
+
 // Convenient type aliases
 template <typename T> using PoolVector = std::vector<T, ScopedPoolAllocator<T>>;
 
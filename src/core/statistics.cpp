@@ -0,0 +1,111 @@
+#include "statistics.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace TextSimilarity::Core {
+
+namespace {
+
+// Bucket i covers [2^i, 2^(i+1)) ns
+size_t latency_bucket(uint64_t duration_ns) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  if (duration_ns == 0) {
+    return 0;
+  }
+  const size_t bucket = 63 - static_cast<size_t>(__builtin_clzll(duration_ns));
+#else
+  size_t bucket = 0;
+  while (duration_ns > 1) {
+    duration_ns >>= 1;
+    ++bucket;
+  }
+#endif
+  return bucket < AlgorithmMetrics::BUCKET_COUNT
+             ? bucket
+             : AlgorithmMetrics::BUCKET_COUNT - 1;
+}
+
+} // namespace
+
+// Owned by one thread for writing; other threads only load or store zero,
+// so relaxed ordering is sufficient throughout
+struct AlgorithmMetrics::ThreadBlock {
+  std::array<std::atomic<uint64_t>, ALGORITHM_COUNT> calls{};
+  std::array<std::atomic<uint64_t>, ALGORITHM_COUNT> total_time_ns{};
+  std::array<std::array<std::atomic<uint64_t>, BUCKET_COUNT>, ALGORITHM_COUNT>
+      latency_buckets{};
+};
+
+namespace {
+
+std::mutex g_registry_mutex;
+
+} // namespace
+
+// Blocks outlive their threads so late aggregation stays valid; a few KB
+// per thread that ever ran a comparison is an acceptable ceiling
+std::vector<std::shared_ptr<AlgorithmMetrics::ThreadBlock>> &
+AlgorithmMetrics::registry() {
+  static std::vector<std::shared_ptr<ThreadBlock>> blocks;
+  return blocks;
+}
+
+AlgorithmMetrics::ThreadBlock &AlgorithmMetrics::local_block() {
+  thread_local std::shared_ptr<ThreadBlock> block = [] {
+    auto created = std::make_shared<ThreadBlock>();
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    registry().push_back(created);
+    return created;
+  }();
+  return *block;
+}
+
+void AlgorithmMetrics::record(AlgorithmType type,
+                              uint64_t duration_ns) noexcept {
+  const auto index = static_cast<size_t>(type);
+  if (index >= ALGORITHM_COUNT) {
+    return;
+  }
+
+  auto &block = local_block();
+  block.calls[index].fetch_add(1, std::memory_order_relaxed);
+  block.total_time_ns[index].fetch_add(duration_ns, std::memory_order_relaxed);
+  block.latency_buckets[index][latency_bucket(duration_ns)].fetch_add(
+      1, std::memory_order_relaxed);
+}
+
+AlgorithmMetrics::Snapshot AlgorithmMetrics::aggregate() {
+  Snapshot snapshot;
+
+  std::lock_guard<std::mutex> lock(g_registry_mutex);
+  for (const auto &block : registry()) {
+    for (size_t a = 0; a < ALGORITHM_COUNT; ++a) {
+      snapshot.calls[a] += block->calls[a].load(std::memory_order_relaxed);
+      snapshot.total_time_ns[a] +=
+          block->total_time_ns[a].load(std::memory_order_relaxed);
+      for (size_t b = 0; b < BUCKET_COUNT; ++b) {
+        snapshot.latency_buckets[a][b] +=
+            block->latency_buckets[a][b].load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  return snapshot;
+}
+
+void AlgorithmMetrics::reset() noexcept {
+  std::lock_guard<std::mutex> lock(g_registry_mutex);
+  for (const auto &block : registry()) {
+    for (size_t a = 0; a < ALGORITHM_COUNT; ++a) {
+      block->calls[a].store(0, std::memory_order_relaxed);
+      block->total_time_ns[a].store(0, std::memory_order_relaxed);
+      for (size_t b = 0; b < BUCKET_COUNT; ++b) {
+        block->latency_buckets[a][b].store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+}
+
+} // namespace TextSimilarity::Core
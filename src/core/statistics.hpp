@@ -0,0 +1,50 @@
+#pragma once
+
+#include "types.hpp"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace TextSimilarity::Core {
+
+// Process-wide, low-overhead algorithm instrumentation.
+//
+// Every timed algorithm call records into a counter block owned by the
+// calling thread, so the hot path is a few relaxed atomic increments with
+// no cache-line sharing between threads. Readers aggregate all thread
+// blocks under a registry lock; recording threads never take it.
+//
+// Latency lands in power-of-two nanosecond buckets: bucket i counts
+// durations in [2^i, 2^(i+1)) ns, with the last bucket absorbing
+// everything from ~2.1s up.
+class AlgorithmMetrics final {
+public:
+  static constexpr size_t ALGORITHM_COUNT = 13;
+  static constexpr size_t BUCKET_COUNT = 32;
+
+  struct Snapshot {
+    std::array<uint64_t, ALGORITHM_COUNT> calls{};
+    std::array<uint64_t, ALGORITHM_COUNT> total_time_ns{};
+    std::array<std::array<uint64_t, BUCKET_COUNT>, ALGORITHM_COUNT>
+        latency_buckets{};
+  };
+
+  static void record(AlgorithmType type, uint64_t duration_ns) noexcept;
+
+  // Sums all per-thread blocks into one snapshot
+  [[nodiscard]] static Snapshot aggregate();
+
+  // Zeroes all per-thread blocks. Counts recorded concurrently with the
+  // reset may land on either side of it; counters never go inconsistent
+  static void reset() noexcept;
+
+private:
+  AlgorithmMetrics() = delete;
+
+  struct ThreadBlock;
+  [[nodiscard]] static ThreadBlock &local_block();
+  [[nodiscard]] static std::vector<std::shared_ptr<ThreadBlock>> &registry();
+};
+
+} // namespace TextSimilarity::Core
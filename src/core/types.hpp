@@ -58,6 +58,57 @@ struct AlgorithmConfig {
   std::optional<double> prefix_weight{};     // Jaro-Winkler prefix weight
   std::optional<uint32_t> prefix_length{};   // Jaro-Winkler prefix length
   std::optional<size_t> max_string_length{}; // Max input string length (bytes)
+  std::optional<size_t> cache_capacity{};    // Result cache entry capacity
+  std::optional<uint32_t> minhash_permutations{}; // MinHash signature length
+  std::optional<uint32_t> lsh_bands{};            // LSH band count
+  std::optional<bool> shared_cache{};          // Cross-process result cache
+  std::optional<std::string> shared_cache_name{};  // Shared memory name
+  std::optional<size_t> shared_cache_bytes{};      // Shared segment size
+};
+
+// One stage of a cascade pipeline: the algorithm to run, its overrides
+// and the score a pair must reach to advance to the next stage
+struct CascadeStage {
+  AlgorithmType algorithm{AlgorithmType::Levenshtein};
+  AlgorithmConfig config{};
+  double min_score{0.0};
+};
+
+// Result of running one pair through a cascade
+struct CascadeOutcome {
+  bool passed{false}; // True when every stage reached its cutoff
+  uint32_t stage{0};  // Last stage that ran (the failing or final one)
+  double score{0.0};  // Score from that stage
+};
+
+// Single match returned by top-K queries
+struct TopKMatch {
+  size_t index{0};       // Position in the candidate array
+  double similarity{0.0};
+};
+
+// Snapshot of result cache counters for diagnostics
+struct CacheStatistics {
+  size_t hits{0};
+  size_t misses{0};
+  size_t evictions{0};
+  size_t entries{0};
+  size_t capacity{0};
+};
+
+// Snapshot of async executor counters for diagnostics
+struct ExecutorStatistics {
+  size_t worker_count{0};
+  size_t pending_tasks{0};  // Queued but not yet picked up
+  size_t executed_tasks{0}; // Completed since startup
+  size_t steals{0};         // Tasks taken from another worker's deque
+  uint64_t task_wait_ns{0}; // Total time tasks spent queued before running
+};
+
+// Snapshot of candidate prefilter counters for diagnostics
+struct PrefilterStatistics {
+  size_t considered{0}; // Candidates the prefilter was consulted for
+  size_t skipped{0};    // Candidates rejected without running the full DP
 };
 
 // Result types with comprehensive error handling
@@ -126,8 +177,16 @@ private:
 
 using SimilarityResult = Result<double>;
 using DistanceResult = Result<uint32_t>;
+using CascadeResult = Result<CascadeOutcome>;
 
 // Unicode-safe string types
+//
+// The UTF-8 form is the source of truth; the UTF-32 form is materialized
+// lazily on the first unicode() access, so pure-ASCII fast paths (which only
+// touch utf8()) never pay the 4x codepoint copy or its allocation. Short
+// strings stay inline via the std::string small-string buffer. Lazy
+// materialization is not synchronized: convert before sharing an instance
+// across threads (see SimilarityEngine::similarity_matrix).
 class UnicodeString final {
 public:
   explicit UnicodeString(std::string utf8_string);
@@ -136,13 +195,13 @@ public:
   [[nodiscard]] const std::string &utf8() const noexcept {
     return utf8_string_;
   }
-  [[nodiscard]] const std::u32string &unicode() const noexcept {
-    return unicode_string_;
-  }
-  [[nodiscard]] size_t length() const noexcept {
-    return unicode_string_.length();
-  }
-  [[nodiscard]] bool empty() const noexcept { return unicode_string_.empty(); }
+  [[nodiscard]] const std::u32string &unicode() const;
+  [[nodiscard]] size_t length() const noexcept { return codepoint_count_; }
+  [[nodiscard]] bool empty() const noexcept { return utf8_string_.empty(); }
+
+  // True when every codepoint is ASCII; computed once during validation so
+  // algorithms do not re-scan per call
+  [[nodiscard]] bool is_ascii() const noexcept { return is_ascii_; }
 
   // Case conversion methods
   [[nodiscard]] UnicodeString to_lower() const;
@@ -154,9 +213,14 @@ public:
 
 private:
   std::string utf8_string_;
-  std::u32string unicode_string_;
-
-  void validate_and_convert();
+  // Cache of the UTF-32 form; mutable because materializing it does not
+  // change the logical value
+  mutable std::u32string unicode_string_;
+  mutable bool unicode_built_{false};
+  size_t codepoint_count_{0};
+  bool is_ascii_{true};
+
+  void validate_and_scan();
 };
 
 // Memory-safe containers
@@ -1,213 +1,314 @@
 #include "types.hpp"
 #include <algorithm>
+#include <cstdint>
 #include <locale>
 #include <stdexcept>
 #include <utility>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h> // For SIMD intrinsics (x86/x64 only)
+#elif defined(__aarch64__) || defined(__arm__)
+#include <arm_neon.h> // For NEON intrinsics (ARM64/ARM32)
+#endif
+
 namespace TextSimilarity::Core {
 
 namespace {
-// Unicode-aware case conversion tables
-constexpr std::pair<char32_t, char32_t> uppercase_to_lowercase_basic[] = {
-    // ASCII uppercase to lowercase
-    {'A', 'a'},
-    {'B', 'b'},
-    {'C', 'c'},
-    {'D', 'd'},
-    {'E', 'e'},
-    {'F', 'f'},
-    {'G', 'g'},
-    {'H', 'h'},
-    {'I', 'i'},
-    {'J', 'j'},
-    {'K', 'k'},
-    {'L', 'l'},
-    {'M', 'm'},
-    {'N', 'n'},
-    {'O', 'o'},
-    {'P', 'p'},
-    {'Q', 'q'},
-    {'R', 'r'},
-    {'S', 's'},
-    {'T', 't'},
-    {'U', 'u'},
-    {'V', 'v'},
-    {'W', 'w'},
-    {'X', 'x'},
-    {'Y', 'y'},
-    {'Z', 'z'},
-
-    // Latin-1 Supplement
-    {0x00C0, 0x00E0},
-    {0x00C1, 0x00E1},
-    {0x00C2, 0x00E2},
-    {0x00C3, 0x00E3},
-    {0x00C4, 0x00E4},
-    {0x00C5, 0x00E5},
-    {0x00C6, 0x00E6},
-    {0x00C7, 0x00E7},
-    {0x00C8, 0x00E8},
-    {0x00C9, 0x00E9},
-    {0x00CA, 0x00EA},
-    {0x00CB, 0x00EB},
-    {0x00CC, 0x00EC},
-    {0x00CD, 0x00ED},
-    {0x00CE, 0x00EE},
-    {0x00CF, 0x00EF},
-    {0x00D0, 0x00F0},
-    {0x00D1, 0x00F1},
-    {0x00D2, 0x00F2},
-    {0x00D3, 0x00F3},
-    {0x00D4, 0x00F4},
-    {0x00D5, 0x00F5},
-    {0x00D6, 0x00F6},
-    {0x00D8, 0x00F8},
-    {0x00D9, 0x00F9},
-    {0x00DA, 0x00FA},
-    {0x00DB, 0x00FB},
-    {0x00DC, 0x00FC},
-    {0x00DD, 0x00FD},
-    {0x00DE, 0x00FE},
-
-    // Greek uppercase to lowercase
-    {0x0391, 0x03B1},
-    {0x0392, 0x03B2},
-    {0x0393, 0x03B3},
-    {0x0394, 0x03B4},
-    {0x0395, 0x03B5},
-    {0x0396, 0x03B6},
-    {0x0397, 0x03B7},
-    {0x0398, 0x03B8},
-    {0x0399, 0x03B9},
-    {0x039A, 0x03BA},
-    {0x039B, 0x03BB},
-    {0x039C, 0x03BC},
-    {0x039D, 0x03BD},
-    {0x039E, 0x03BE},
-    {0x039F, 0x03BF},
-    {0x03A0, 0x03C0},
-    {0x03A1, 0x03C1},
-    {0x03A3, 0x03C3},
-    {0x03A4, 0x03C4},
-    {0x03A5, 0x03C5},
-    {0x03A6, 0x03C6},
-    {0x03A7, 0x03C7},
-    {0x03A8, 0x03C8},
-    {0x03A9, 0x03C9},
-
-    // Greek accented letters
-    {0x0386, 0x03AC},
-    {0x0388, 0x03AD},
-    {0x0389, 0x03AE},
-    {0x038A, 0x03AF},
-    {0x038C, 0x03CC},
-    {0x038E, 0x03CD},
-    {0x038F, 0x03CE},
-
-    // Cyrillic uppercase to lowercase
-    {0x0410, 0x0430},
-    {0x0411, 0x0431},
-    {0x0412, 0x0432},
-    {0x0413, 0x0433},
-    {0x0414, 0x0434},
-    {0x0415, 0x0435},
-    {0x0416, 0x0436},
-    {0x0417, 0x0437},
-    {0x0418, 0x0438},
-    {0x0419, 0x0439},
-    {0x041A, 0x043A},
-    {0x041B, 0x043B},
-    {0x041C, 0x043C},
-    {0x041D, 0x043D},
-    {0x041E, 0x043E},
-    {0x041F, 0x043F},
-    {0x0420, 0x0440},
-    {0x0421, 0x0441},
-    {0x0422, 0x0442},
-    {0x0423, 0x0443},
-    {0x0424, 0x0444},
-    {0x0425, 0x0445},
-    {0x0426, 0x0446},
-    {0x0427, 0x0447},
-    {0x0428, 0x0448},
-    {0x0429, 0x0449},
-    {0x042A, 0x044A},
-    {0x042B, 0x044B},
-    {0x042C, 0x044C},
-    {0x042D, 0x044D},
-    {0x042E, 0x044E},
-    {0x042F, 0x044F}};
-
-char32_t unicode_tolower_optimized(char32_t c) noexcept {
-  // Fast path for ASCII
-  if (c >= 'A' && c <= 'Z') {
-    return c + 32;
+// Simple case mappings for the Basic Multilingual Plane, expressed as
+// compact range rules and expanded at compile time into two-level page
+// tables. Each rule covers a contiguous block with a fixed delta;
+// alternating rules cover the interleaved blocks (Latin Extended, later
+// Cyrillic) where the lowercase letter directly follows its uppercase
+// partner. Fold-only rules map distinct lowercase or symbol forms onto
+// their canonical letter and are excluded from the reverse (to_upper)
+// table so round-trips stay stable.
+struct CaseRule {
+  char32_t first;
+  char32_t last;
+  int32_t delta;
+  bool alternating;
+  bool fold_only;
+};
+
+constexpr CaseRule case_rules[] = {
+    // ASCII and Latin-1 Supplement
+    {U'A', U'Z', 32, false, false},
+    {0x00C0, 0x00D6, 32, false, false},
+    {0x00D8, 0x00DE, 32, false, false},
+    // Latin Extended-A
+    {0x0100, 0x012E, 1, true, false},
+    {0x0132, 0x0136, 1, true, false},
+    {0x0139, 0x0147, 1, true, false},
+    {0x014A, 0x0176, 1, true, false},
+    {0x0178, 0x0178, -121, false, false}, // Y with diaeresis
+    {0x0179, 0x017D, 1, true, false},
+    // Latin Extended-B (the regular alternating stretches)
+    {0x01CD, 0x01DB, 1, true, false},
+    {0x01DE, 0x01EE, 1, true, false},
+    {0x01F8, 0x021E, 1, true, false},
+    {0x0222, 0x0232, 1, true, false},
+    {0x0246, 0x024E, 1, true, false},
+    // Greek, including the accented forms
+    {0x0386, 0x0386, 38, false, false},
+    {0x0388, 0x038A, 37, false, false},
+    {0x038C, 0x038C, 64, false, false},
+    {0x038E, 0x038F, 63, false, false},
+    {0x0391, 0x03A1, 32, false, false},
+    {0x03A3, 0x03AB, 32, false, false},
+    {0x03C2, 0x03C2, 1, false, true}, // Final sigma -> regular sigma
+    {0x03D8, 0x03EE, 1, true, false},
+    // Cyrillic
+    {0x0400, 0x040F, 80, false, false},
+    {0x0410, 0x042F, 32, false, false},
+    {0x0460, 0x0480, 1, true, false},
+    {0x048A, 0x04BE, 1, true, false},
+    {0x04C1, 0x04CD, 1, true, false},
+    {0x04D0, 0x052E, 1, true, false},
+    // Armenian
+    {0x0531, 0x0556, 48, false, false},
+    // Latin Extended Additional
+    {0x1E00, 0x1E94, 1, true, false},
+    {0x1EA0, 0x1EFE, 1, true, false},
+    // Greek Extended
+    {0x1F08, 0x1F0F, -8, false, false},
+    {0x1F18, 0x1F1D, -8, false, false},
+    {0x1F28, 0x1F2F, -8, false, false},
+    {0x1F38, 0x1F3F, -8, false, false},
+    {0x1F48, 0x1F4D, -8, false, false},
+    {0x1F59, 0x1F5F, -8, true, false},
+    {0x1F68, 0x1F6F, -8, false, false},
+    {0x1FB8, 0x1FB9, -8, false, false},
+    {0x1FBA, 0x1FBB, -74, false, false},
+    {0x1FC8, 0x1FCB, -86, false, false},
+    {0x1FD8, 0x1FD9, -8, false, false},
+    {0x1FDA, 0x1FDB, -100, false, false},
+    {0x1FE8, 0x1FE9, -8, false, false},
+    {0x1FEA, 0x1FEB, -112, false, false},
+    {0x1FEC, 0x1FEC, -7, false, false},
+    {0x1FF8, 0x1FF9, -128, false, false},
+    {0x1FFA, 0x1FFB, -126, false, false},
+    // Letterlike symbols fold to their letter forms
+    {0x2126, 0x2126, -7517, false, true}, // Ohm -> omega
+    {0x212A, 0x212A, -8383, false, true}, // Kelvin -> k
+    {0x212B, 0x212B, -8262, false, true}, // Angstrom -> a with ring
+    // Roman numerals, circled letters, fullwidth forms
+    {0x2160, 0x216F, 16, false, false},
+    {0x24B6, 0x24CF, 26, false, false},
+    {0xFF21, 0xFF3A, 32, false, false},
+};
+
+// Two-level lookup over the BMP: the page index maps the high byte of a
+// codepoint to a delta page, pages without any mapping all share the
+// all-zero identity page 0. Lookups are two dependent loads and one add,
+// independent of how many ranges the rule list grows to.
+constexpr size_t CASE_PAGE_SIZE = 256;
+constexpr size_t CASE_PAGE_COUNT = 256;
+constexpr size_t CASE_MAX_DATA_PAGES = 24;
+
+struct CaseTable {
+  uint8_t page_index[CASE_PAGE_COUNT] = {};
+  int16_t deltas[CASE_MAX_DATA_PAGES][CASE_PAGE_SIZE] = {};
+};
+
+constexpr CaseTable build_case_table(bool to_lower_table) {
+  CaseTable table;
+  size_t page_count = 1; // Page 0 is the shared identity page
+  for (const CaseRule &rule : case_rules) {
+    if (!to_lower_table && rule.fold_only) {
+      continue;
+    }
+    const char32_t step = rule.alternating ? 2 : 1;
+    for (char32_t upper = rule.first; upper <= rule.last; upper += step) {
+      const char32_t from =
+          to_lower_table
+              ? upper
+              : static_cast<char32_t>(static_cast<int32_t>(upper) +
+                                      rule.delta);
+      const int32_t delta = to_lower_table ? rule.delta : -rule.delta;
+      const size_t page = from >> 8;
+      if (table.page_index[page] == 0) {
+        table.page_index[page] = static_cast<uint8_t>(page_count++);
+      }
+      int16_t &slot = table.deltas[table.page_index[page]][from & 0xFF];
+      if (slot == 0) { // First rule wins on reverse-mapping collisions
+        slot = static_cast<int16_t>(delta);
+      }
+    }
   }
+  return table;
+}
 
-  // Binary search for efficiency
-  const auto *begin = std::begin(uppercase_to_lowercase_basic);
-  const auto *end = std::end(uppercase_to_lowercase_basic);
-
-  const auto *found =
-      std::lower_bound(begin, end, c, [](const auto &pair, char32_t value) {
-        return pair.first < value;
-      });
-
-  if (found != end && found->first == c) {
-    return found->second;
-  }
+constexpr CaseTable lowercase_table = build_case_table(true);
+constexpr CaseTable uppercase_table = build_case_table(false);
 
-  // Special cases
-  if (c == 0x03C2) { // Final sigma -> regular sigma
-    return 0x03C3;
+constexpr char32_t table_convert(const CaseTable &table, char32_t c) noexcept {
+  if (c > 0xFFFF) {
+    return c; // Simple case mappings above the BMP are not covered
   }
+  return static_cast<char32_t>(static_cast<int32_t>(c) +
+                               table.deltas[table.page_index[c >> 8]][c & 0xFF]);
+}
 
-  return c; // No conversion needed
+char32_t unicode_tolower_optimized(char32_t c) noexcept {
+  return table_convert(lowercase_table, c);
 }
 
 char32_t unicode_toupper_optimized(char32_t c) noexcept {
-  // Fast path for ASCII
-  if (c >= 'a' && c <= 'z') {
-    return c - 32;
+  return table_convert(uppercase_table, c);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+inline bool cpu_has_avx2() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  static const bool supported = __builtin_cpu_supports("avx2") != 0;
+  return supported;
+#elif defined(__AVX2__)
+  return true;
+#else
+  return false;
+#endif
+}
+
+#if defined(__AVX2__)
+void ascii_shift_case_avx2(char *data, size_t length, char first, char last,
+                           char delta) noexcept {
+  const __m256i lo = _mm256_set1_epi8(first - 1);
+  const __m256i hi = _mm256_set1_epi8(last + 1);
+  const __m256i shift = _mm256_set1_epi8(delta);
+
+  size_t i = 0;
+  for (; i + 32 <= length; i += 32) {
+    __m256i chunk =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+    const __m256i in_range = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, lo),
+                                              _mm256_cmpgt_epi8(hi, chunk));
+    chunk = _mm256_add_epi8(chunk, _mm256_and_si256(in_range, shift));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(data + i), chunk);
   }
 
-  // Binary search in reverse
-  const auto *begin = std::begin(uppercase_to_lowercase_basic);
-  const auto *end = std::end(uppercase_to_lowercase_basic);
+  for (; i < length; ++i) {
+    if (data[i] >= first && data[i] <= last) {
+      data[i] = static_cast<char>(data[i] + delta);
+    }
+  }
+}
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)
+void ascii_shift_case_sse(char *data, size_t length, char first, char last,
+                          char delta) noexcept {
+  const __m128i lo = _mm_set1_epi8(first - 1);
+  const __m128i hi = _mm_set1_epi8(last + 1);
+  const __m128i shift = _mm_set1_epi8(delta);
+
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+    const __m128i in_range =
+        _mm_and_si128(_mm_cmpgt_epi8(chunk, lo), _mm_cmpgt_epi8(hi, chunk));
+    chunk = _mm_add_epi8(chunk, _mm_and_si128(in_range, shift));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(data + i), chunk);
+  }
 
-  const auto *found = std::find_if(
-      begin, end, [c](const auto &pair) { return pair.second == c; });
+  for (; i < length; ++i) {
+    if (data[i] >= first && data[i] <= last) {
+      data[i] = static_cast<char>(data[i] + delta);
+    }
+  }
+}
+#endif
+
+#elif defined(__aarch64__)
+void ascii_shift_case_neon(char *data, size_t length, char first, char last,
+                           char delta) noexcept {
+  const uint8x16_t lo = vdupq_n_u8(static_cast<uint8_t>(first));
+  const uint8x16_t hi = vdupq_n_u8(static_cast<uint8_t>(last));
+  const uint8x16_t shift = vdupq_n_u8(static_cast<uint8_t>(delta));
+
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(data + i));
+    const uint8x16_t in_range =
+        vandq_u8(vcgeq_u8(chunk, lo), vcleq_u8(chunk, hi));
+    chunk = vaddq_u8(chunk, vandq_u8(in_range, shift));
+    vst1q_u8(reinterpret_cast<uint8_t *>(data + i), chunk);
+  }
 
-  if (found != end) {
-    return found->first;
+  for (; i < length; ++i) {
+    if (data[i] >= first && data[i] <= last) {
+      data[i] = static_cast<char>(data[i] + delta);
+    }
+  }
+}
+#endif
+
+// In-place case shift for pure-ASCII buffers: every byte in [first, last]
+// moves by delta, a full vector register at a time where available. The
+// unsigned byte add wraps, so a negative delta works on all paths.
+void ascii_shift_case(std::string &s, char first, char last,
+                      char delta) noexcept {
+  const size_t length = s.length();
+  char *data = s.data();
+
+#if defined(__x86_64__) || defined(__i386__)
+#if defined(__AVX2__)
+  if (length >= 32 && cpu_has_avx2()) {
+    ascii_shift_case_avx2(data, length, first, last, delta);
+    return;
+  }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+  if (length >= 16) {
+    ascii_shift_case_sse(data, length, first, last, delta);
+    return;
+  }
+#endif
+#elif defined(__aarch64__)
+  if (length >= 16) {
+    ascii_shift_case_neon(data, length, first, last, delta);
+    return;
   }
+#endif
 
-  return c; // No conversion needed
+  for (size_t i = 0; i < length; ++i) {
+    if (data[i] >= first && data[i] <= last) {
+      data[i] = static_cast<char>(data[i] + delta);
+    }
+  }
 }
 
-// UTF-8 decoding function
+// UTF-8 decoding function. The decoder stays lenient about malformed
+// content — Buffer and Uint8Array inputs reach it unvalidated — but must
+// never read past the end of the string: a multibyte sequence truncated by
+// the end of input decodes to U+FFFD instead of indexing out of bounds.
 std::u32string utf8_to_utf32(const std::string &s) {
+  const size_t length = s.length();
   std::u32string result;
-  result.reserve(s.length());
+  result.reserve(length);
 
-  for (size_t i = 0; i < s.length();) {
+  for (size_t i = 0; i < length;) {
     char32_t c;
     unsigned char c1 = s[i];
 
-    if (c1 < 0x80) {
+    const size_t sequence_length =
+        (c1 < 0x80) ? 1 : (c1 < 0xE0) ? 2 : (c1 < 0xF0) ? 3 : 4;
+    if (sequence_length > length - i) {
+      result.push_back(0xFFFD);
+      break;
+    }
+
+    if (sequence_length == 1) {
       c = c1;
-      i += 1;
-    } else if (c1 < 0xE0) {
+    } else if (sequence_length == 2) {
       c = ((c1 & 0x1F) << 6) | (s[i + 1] & 0x3F);
-      i += 2;
-    } else if (c1 < 0xF0) {
+    } else if (sequence_length == 3) {
       c = ((c1 & 0x0F) << 12) | ((s[i + 1] & 0x3F) << 6) | (s[i + 2] & 0x3F);
-      i += 3;
     } else {
       c = ((c1 & 0x07) << 18) | ((s[i + 1] & 0x3F) << 12) |
           ((s[i + 2] & 0x3F) << 6) | (s[i + 3] & 0x3F);
-      i += 4;
     }
+    i += sequence_length;
     result.push_back(c);
   }
   return result;
@@ -242,40 +343,85 @@ std::string utf32_to_utf8(const std::u32string &s) {
 // UnicodeString implementation
 UnicodeString::UnicodeString(std::string utf8_string)
     : utf8_string_(std::move(utf8_string)) {
-  validate_and_convert();
+  validate_and_scan();
 }
 
 UnicodeString::UnicodeString(std::u32string unicode_string)
-    : unicode_string_(std::move(unicode_string)) {
+    : unicode_string_(std::move(unicode_string)), unicode_built_(true),
+      codepoint_count_(unicode_string_.length()) {
   utf8_string_ = utf32_to_utf8(unicode_string_);
+  is_ascii_ = std::all_of(unicode_string_.begin(), unicode_string_.end(),
+                          [](char32_t c) { return c < 0x80; });
+}
+
+void UnicodeString::validate_and_scan() {
+  // Single pass over the UTF-8 bytes: codepoints are counted (continuation
+  // bytes are skipped) and the ASCII flag is derived without building the
+  // UTF-32 form
+  size_t count = 0;
+  bool ascii = true;
+
+  for (unsigned char byte : utf8_string_) {
+    if (byte >= 0x80) {
+      ascii = false;
+    }
+    if ((byte & 0xC0) != 0x80) {
+      ++count;
+    }
+  }
+
+  codepoint_count_ = count;
+  is_ascii_ = ascii;
 }
 
-void UnicodeString::validate_and_convert() {
-  unicode_string_ = utf8_to_utf32(utf8_string_);
+const std::u32string &UnicodeString::unicode() const {
+  if (!unicode_built_) {
+    unicode_string_ = utf8_to_utf32(utf8_string_);
+    unicode_built_ = true;
+  }
+  return unicode_string_;
 }
 
 UnicodeString UnicodeString::to_lower() const {
+  // ASCII strings fold byte-wise without materializing the UTF-32 form,
+  // a full vector register at a time where available
+  if (is_ascii_) {
+    std::string result = utf8_string_;
+    ascii_shift_case(result, 'A', 'Z', 32);
+    return UnicodeString(std::move(result));
+  }
+
+  const auto &source = unicode();
   std::u32string result;
-  result.reserve(unicode_string_.length());
+  result.reserve(source.length());
 
-  std::transform(unicode_string_.begin(), unicode_string_.end(),
-                 std::back_inserter(result), unicode_tolower_optimized);
+  std::transform(source.begin(), source.end(), std::back_inserter(result),
+                 unicode_tolower_optimized);
 
   return UnicodeString(std::move(result));
 }
 
 UnicodeString UnicodeString::to_upper() const {
+  if (is_ascii_) {
+    std::string result = utf8_string_;
+    ascii_shift_case(result, 'a', 'z', -32);
+    return UnicodeString(std::move(result));
+  }
+
+  const auto &source = unicode();
   std::u32string result;
-  result.reserve(unicode_string_.length());
+  result.reserve(source.length());
 
-  std::transform(unicode_string_.begin(), unicode_string_.end(),
-                 std::back_inserter(result), unicode_toupper_optimized);
+  std::transform(source.begin(), source.end(), std::back_inserter(result),
+                 unicode_toupper_optimized);
 
   return UnicodeString(std::move(result));
 }
 
 bool UnicodeString::operator==(const UnicodeString &other) const noexcept {
-  return unicode_string_ == other.unicode_string_;
+  // Valid UTF-8 encodes each codepoint sequence uniquely, so byte equality
+  // matches codepoint equality without touching the UTF-32 cache
+  return utf8_string_ == other.utf8_string_;
 }
 
 bool UnicodeString::operator!=(const UnicodeString &other) const noexcept {
@@ -0,0 +1,124 @@
+#include "cascade.hpp"
+#include "../core/algorithm_factory.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace TextSimilarity::Engine {
+
+Cascade::Cascade(std::vector<Core::CascadeStage> stages)
+    : factory_(Core::create_algorithm_factory()) {
+  if (stages.empty()) {
+    throw std::invalid_argument("Cascade requires at least one stage");
+  }
+
+  stages_.reserve(stages.size());
+  for (auto &spec : stages) {
+    stages_.push_back(
+        Stage{factory_->create_algorithm(spec.algorithm, spec.config),
+              spec.min_score});
+  }
+}
+
+Core::CascadeResult
+Cascade::evaluate_unicode(const Core::UnicodeString &s1,
+                          const Core::UnicodeString &s2) const {
+  Core::CascadeOutcome outcome;
+  for (size_t i = 0; i < stages_.size(); ++i) {
+    auto result = stages_[i].algorithm->calculate_similarity(s1, s2);
+    if (!result.is_success()) {
+      return Core::CascadeResult(result.error());
+    }
+
+    outcome.stage = static_cast<uint32_t>(i);
+    outcome.score = result.value();
+    if (outcome.score < stages_[i].min_score) {
+      outcome.passed = false;
+      return Core::CascadeResult(outcome);
+    }
+  }
+
+  outcome.passed = true;
+  return Core::CascadeResult(outcome);
+}
+
+Core::CascadeResult Cascade::evaluate(std::string_view s1,
+                                      std::string_view s2) const {
+  // One UnicodeString conversion per input, shared by every stage
+  Core::UnicodeString u1{std::string(s1)};
+  Core::UnicodeString u2{std::string(s2)};
+  return evaluate_unicode(u1, u2);
+}
+
+std::vector<Core::CascadeResult> Cascade::evaluate_batch(
+    const std::vector<std::pair<std::string, std::string>> &pairs) const {
+  std::vector<Core::CascadeResult> results;
+  results.reserve(pairs.size());
+  for (const auto &[s1, s2] : pairs) {
+    Core::UnicodeString u1{s1};
+    Core::UnicodeString u2{s2};
+    results.push_back(evaluate_unicode(u1, u2));
+  }
+  return results;
+}
+
+std::vector<Core::TopKMatch>
+Cascade::match(std::string_view query,
+               const std::vector<std::string_view> &candidates) const {
+  Core::UnicodeString query_string{std::string(query)};
+
+  std::vector<Core::UnicodeString> candidate_strings;
+  candidate_strings.reserve(candidates.size());
+  for (const auto &candidate : candidates) {
+    candidate_strings.emplace_back(std::string(candidate));
+  }
+
+  // Survivor list narrows as the stages progress; each stage prepares the
+  // query once and scores only what the previous stage let through
+  std::vector<size_t> survivors(candidates.size());
+  for (size_t i = 0; i < survivors.size(); ++i) {
+    survivors[i] = i;
+  }
+  std::vector<double> scores(candidates.size(), 0.0);
+
+  for (const auto &stage : stages_) {
+    if (survivors.empty()) {
+      break;
+    }
+
+    auto prepared = stage.algorithm->prepare_query(query_string);
+
+    std::vector<size_t> passing;
+    passing.reserve(survivors.size());
+    for (size_t index : survivors) {
+      auto result = stage.algorithm->calculate_similarity_prepared(
+          *prepared, candidate_strings[index]);
+      if (!result.is_success() || result.value() < stage.min_score) {
+        continue;
+      }
+      scores[index] = result.value();
+      passing.push_back(index);
+    }
+    survivors = std::move(passing);
+  }
+
+  std::vector<Core::TopKMatch> matches;
+  matches.reserve(survivors.size());
+  for (size_t index : survivors) {
+    matches.push_back(Core::TopKMatch{index, scores[index]});
+  }
+
+  // Best first by the final stage's score; ties break toward the earlier
+  // candidate for determinism
+  std::sort(matches.begin(), matches.end(),
+            [](const Core::TopKMatch &a, const Core::TopKMatch &b) {
+              if (a.similarity != b.similarity) {
+                return a.similarity > b.similarity;
+              }
+              return a.index < b.index;
+            });
+
+  return matches;
+}
+
+} // namespace TextSimilarity::Engine
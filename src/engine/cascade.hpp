@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../core/interfaces.hpp"
+#include "../core/types.hpp"
+
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace TextSimilarity::Engine {
+
+// ICascade implementation. Each stage owns its algorithm instance, so the
+// factory allocation and configuration merge are paid once at creation;
+// inputs are converted to UnicodeString once per call and shared across
+// stages, replacing the two-round-trip screen-then-confirm pattern callers
+// previously hand-rolled through the bindings.
+class Cascade final : public Core::ICascade {
+public:
+  // Stage configs must already be merged; the engine factory does that.
+  // Throws std::invalid_argument when stages is empty.
+  explicit Cascade(std::vector<Core::CascadeStage> stages);
+
+  ~Cascade() override = default;
+
+  [[nodiscard]] Core::CascadeResult
+  evaluate(std::string_view s1, std::string_view s2) const override;
+
+  [[nodiscard]] std::vector<Core::CascadeResult> evaluate_batch(
+      const std::vector<std::pair<std::string, std::string>> &pairs)
+      const override;
+
+  [[nodiscard]] std::vector<Core::TopKMatch>
+  match(std::string_view query,
+        const std::vector<std::string_view> &candidates) const override;
+
+  [[nodiscard]] size_t stage_count() const noexcept override {
+    return stages_.size();
+  }
+
+private:
+  struct Stage {
+    std::unique_ptr<Core::ISimilarityAlgorithm> algorithm;
+    double min_score;
+  };
+
+  [[nodiscard]] Core::CascadeResult
+  evaluate_unicode(const Core::UnicodeString &s1,
+                   const Core::UnicodeString &s2) const;
+
+  std::unique_ptr<Core::IAlgorithmFactory> factory_;
+  std::vector<Stage> stages_;
+};
+
+} // namespace TextSimilarity::Engine
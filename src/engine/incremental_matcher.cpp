@@ -0,0 +1,178 @@
+#include "incremental_matcher.hpp"
+#include "../algorithms/base_algorithm.hpp"
+#include "../algorithms/char_kernels.hpp"
+
+#include <algorithm>
+#include <queue>
+#include <stdexcept>
+
+namespace TextSimilarity::Engine {
+
+namespace {
+using Algorithms::Kernels::CaseMode;
+using Algorithms::Kernels::CharEq;
+
+// Append rows [from_row, query.length()] to the retained DP stack. Row r
+// scores the query prefix of length r against the whole candidate; the
+// previous rows are read in place, so extending a query by one character
+// costs exactly one row per candidate. The transposition variant adds the
+// OSA check against row r - 2.
+template <CaseMode Mode, bool Transpositions>
+void extend_rows(std::vector<uint32_t> &rows, const std::u32string &candidate,
+                 const std::u32string &query, size_t from_row) {
+  const size_t width = candidate.length() + 1;
+  rows.resize(width * (query.length() + 1));
+
+  for (size_t r = from_row; r <= query.length(); ++r) {
+    uint32_t *row = rows.data() + r * width;
+    const uint32_t *prev = row - width;
+    const char32_t qc = query[r - 1];
+
+    row[0] = static_cast<uint32_t>(r);
+    for (size_t j = 1; j < width; ++j) {
+      const uint32_t cost = CharEq<char32_t, Mode>::equal(candidate[j - 1], qc)
+                                ? 0
+                                : 1;
+      uint32_t best = std::min(
+          {prev[j] + 1, row[j - 1] + 1, prev[j - 1] + cost});
+
+      if constexpr (Transpositions) {
+        if (r > 1 && j > 1 &&
+            CharEq<char32_t, Mode>::equal(candidate[j - 1], query[r - 2]) &&
+            CharEq<char32_t, Mode>::equal(candidate[j - 2], qc)) {
+          best = std::min(best, *(prev - width + j - 2) + cost);
+        }
+      }
+
+      row[j] = best;
+    }
+  }
+}
+
+using ExtendFn = void (*)(std::vector<uint32_t> &, const std::u32string &,
+                          const std::u32string &, size_t);
+
+ExtendFn select_extend(Core::AlgorithmType algorithm, bool case_sensitive) {
+  const bool transpositions =
+      algorithm == Core::AlgorithmType::DamerauLevenshtein;
+  if (transpositions) {
+    return case_sensitive ? extend_rows<CaseMode::Sensitive, true>
+                          : extend_rows<CaseMode::Insensitive, true>;
+  }
+  return case_sensitive ? extend_rows<CaseMode::Sensitive, false>
+                        : extend_rows<CaseMode::Insensitive, false>;
+}
+} // namespace
+
+IncrementalMatcher::IncrementalMatcher(std::vector<std::string> candidates,
+                                       Core::AlgorithmType algorithm,
+                                       Core::AlgorithmConfig config)
+    : algorithm_(algorithm), config_(std::move(config)) {
+  if (algorithm != Core::AlgorithmType::Levenshtein &&
+      algorithm != Core::AlgorithmType::DamerauLevenshtein) {
+    throw std::invalid_argument(
+        "Incremental matching requires an edit-distance algorithm "
+        "(Levenshtein or Damerau-Levenshtein)");
+  }
+
+  candidates_.reserve(candidates.size());
+  for (auto &candidate : candidates) {
+    Core::UnicodeString raw{std::move(candidate)};
+    auto processed = Algorithms::BaseAlgorithm::preprocess_string(raw, config_);
+    candidates_.push_back(CandidateState{processed.unicode(), {}});
+  }
+}
+
+std::vector<Core::TopKMatch>
+IncrementalMatcher::update(std::string_view query, size_t k,
+                           double min_similarity) {
+  if (k == 0 || candidates_.empty()) {
+    return {};
+  }
+
+  Core::UnicodeString raw{std::string(query)};
+  auto processed = Algorithms::BaseAlgorithm::preprocess_string(raw, config_);
+  const std::u32string &chars = processed.unicode();
+
+  // Longest common prefix with the previous query: rows 0..common stay
+  // valid, everything after is recomputed
+  size_t common = 0;
+  const size_t limit = std::min(chars.length(), query_.length());
+  while (common < limit && chars[common] == query_[common]) {
+    ++common;
+  }
+  query_ = chars;
+
+  const auto extend = select_extend(
+      algorithm_,
+      config_.case_sensitivity == Core::CaseSensitivity::Sensitive);
+
+  // Min-heap keyed on similarity, exactly as in find_top_k: the top is
+  // the current Kth-best score
+  auto worse = [](const Core::TopKMatch &a, const Core::TopKMatch &b) {
+    return a.similarity > b.similarity;
+  };
+  std::priority_queue<Core::TopKMatch, std::vector<Core::TopKMatch>,
+                      decltype(worse)>
+      heap(worse);
+
+  const size_t query_length = query_.length();
+
+  for (size_t i = 0; i < candidates_.size(); ++i) {
+    auto &state = candidates_[i];
+    const size_t width = state.text.length() + 1;
+
+    size_t from_row;
+    if (state.rows.empty()) {
+      state.rows.resize(width);
+      for (size_t j = 0; j < width; ++j) {
+        state.rows[j] = static_cast<uint32_t>(j);
+      }
+      from_row = 1;
+    } else {
+      state.rows.resize(width * (common + 1));
+      from_row = common + 1;
+    }
+
+    if (from_row <= query_length) {
+      extend(state.rows, state.text, query_, from_row);
+    }
+
+    const uint32_t distance = state.rows[query_length * width + width - 1];
+    const size_t max_len = std::max(query_length, state.text.length());
+    const double similarity =
+        (max_len == 0) ? 1.0
+                       : 1.0 - static_cast<double>(distance) /
+                                   static_cast<double>(max_len);
+
+    if (similarity < min_similarity) {
+      continue;
+    }
+
+    if (heap.size() < k) {
+      heap.push(Core::TopKMatch{i, similarity});
+    } else if (similarity > heap.top().similarity) {
+      heap.pop();
+      heap.push(Core::TopKMatch{i, similarity});
+    }
+  }
+
+  // Drain the min-heap back-to-front so the result is best first
+  std::vector<Core::TopKMatch> matches(heap.size());
+  for (auto it = matches.rbegin(); it != matches.rend(); ++it) {
+    *it = heap.top();
+    heap.pop();
+  }
+
+  return matches;
+}
+
+void IncrementalMatcher::reset() {
+  for (auto &state : candidates_) {
+    state.rows.clear();
+    state.rows.shrink_to_fit();
+  }
+  query_.clear();
+}
+
+} // namespace TextSimilarity::Engine
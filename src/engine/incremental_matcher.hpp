@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../core/interfaces.hpp"
+#include "../core/types.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace TextSimilarity::Engine {
+
+// IIncrementalMatcher implementation for Levenshtein and
+// Damerau-Levenshtein (OSA). Each candidate keeps the full stack of DP
+// rows computed for the current query — one row of |candidate| + 1 cells
+// per query character — so update() only computes rows the previous query
+// did not already cover. Autocomplete queries are short, which keeps the
+// retained state at a few hundred bytes per candidate.
+class IncrementalMatcher final : public Core::IIncrementalMatcher {
+public:
+  // Throws std::invalid_argument for algorithms without row-reusable DP
+  // state (anything other than Levenshtein and Damerau-Levenshtein).
+  IncrementalMatcher(std::vector<std::string> candidates,
+                     Core::AlgorithmType algorithm,
+                     Core::AlgorithmConfig config);
+
+  ~IncrementalMatcher() override = default;
+
+  [[nodiscard]] std::vector<Core::TopKMatch>
+  update(std::string_view query, size_t k, double min_similarity) override;
+
+  void reset() override;
+
+  [[nodiscard]] size_t candidate_count() const noexcept override {
+    return candidates_.size();
+  }
+
+  [[nodiscard]] Core::AlgorithmType get_algorithm_type() const noexcept override {
+    return algorithm_;
+  }
+
+private:
+  // Preprocessed candidate plus its retained DP rows against the current
+  // query, row-major with a stride of text.length() + 1
+  struct CandidateState {
+    std::u32string text;
+    std::vector<uint32_t> rows;
+  };
+
+  Core::AlgorithmType algorithm_;
+  Core::AlgorithmConfig config_;
+  std::vector<CandidateState> candidates_;
+  std::u32string query_; // Preprocessed codepoints of the current query
+};
+
+} // namespace TextSimilarity::Engine
@@ -0,0 +1,94 @@
+#include "prefilter.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+namespace TextSimilarity::Engine {
+
+namespace {
+
+// Case folding covering the same ranges as the algorithms' comparison
+// kernels (ASCII, Latin-1, Greek, Cyrillic); must map both cases of any
+// character the algorithms treat as equal into the same bucket, otherwise
+// the histogram bound would overestimate the distance. Codepoints below
+// 128 use the same | 0x20 fold as CharEq<..., Insensitive>, which also
+// identifies the pairs [/{, ]/}, \/|, ^/~ and @/`; folding only A-Z here
+// would make the bound exceed the kernel distance for those pairs and
+// wrongly reject a matching candidate.
+inline char32_t fold_case(char32_t c) noexcept {
+  if (c < 128)
+    return c | 0x20;
+  if (c >= 0x00C0 && c <= 0x00DE && c != 0x00D7)
+    return c + 32;
+  if (c >= 0x0391 && c <= 0x03A9)
+    return c + 32;
+  if (c >= 0x0410 && c <= 0x042F)
+    return c + 32;
+  if (c == 0x03C2) // Final sigma -> regular sigma
+    return 0x03C3;
+  return c;
+}
+
+} // namespace
+
+CandidatePrefilter::CandidatePrefilter(const Core::UnicodeString &query,
+                                       bool case_sensitive)
+    : query_length_(query.length()), case_sensitive_(case_sensitive) {
+  for (char32_t c : query.unicode()) {
+    ++histogram_[bucket(c)];
+  }
+}
+
+uint32_t CandidatePrefilter::distance_lower_bound(
+    const Core::UnicodeString &candidate) const noexcept {
+  const size_t candidate_length = candidate.length();
+
+  // |len(q) - len(c)| insertions or deletions are unavoidable
+  const size_t length_bound = (query_length_ > candidate_length)
+                                  ? query_length_ - candidate_length
+                                  : candidate_length - query_length_;
+
+  // Surplus characters on either side each cost at least one edit: every
+  // query character without a candidate counterpart must be deleted or
+  // substituted, and vice versa
+  auto remaining = histogram_;
+  for (char32_t c : candidate.unicode()) {
+    --remaining[bucket(c)];
+  }
+
+  uint32_t query_surplus = 0;
+  uint32_t candidate_surplus = 0;
+  for (uint32_t count : remaining) {
+    const auto signed_count = static_cast<int32_t>(count);
+    if (signed_count > 0) {
+      query_surplus += static_cast<uint32_t>(signed_count);
+    } else {
+      candidate_surplus += static_cast<uint32_t>(-signed_count);
+    }
+  }
+
+  const uint32_t histogram_bound = std::max(query_surplus, candidate_surplus);
+  return std::max(static_cast<uint32_t>(length_bound), histogram_bound);
+}
+
+bool CandidatePrefilter::can_reach(const Core::UnicodeString &candidate,
+                                   uint32_t max_distance) const noexcept {
+  // Check the O(1) length bound before paying for the histogram walk
+  const size_t candidate_length = candidate.length();
+  const size_t length_bound = (query_length_ > candidate_length)
+                                  ? query_length_ - candidate_length
+                                  : candidate_length - query_length_;
+  if (length_bound > max_distance) {
+    return false;
+  }
+
+  return distance_lower_bound(candidate) <= max_distance;
+}
+
+size_t CandidatePrefilter::bucket(char32_t c) const noexcept {
+  if (!case_sensitive_) {
+    c = fold_case(c);
+  }
+  return static_cast<size_t>(c) & (BUCKET_COUNT - 1);
+}
+
+} // namespace TextSimilarity::Engine
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "../core/types.hpp"
+#include <array>
+#include <cstdint>
+
+namespace TextSimilarity::Engine {
+
+// Cheap candidate rejection tests that run before the full edit-distance DP.
+// The filter is built once per query and gives a provable lower bound on the
+// edit distance to any candidate: the length difference, and the
+// character-frequency histogram surplus (characters one side must insert or
+// delete no matter how the alignment goes). Both bounds are conservative, so
+// a rejected candidate can never reach the requested threshold; candidates
+// that pass still go through the exact computation.
+class CandidatePrefilter {
+public:
+  CandidatePrefilter(const Core::UnicodeString &query, bool case_sensitive);
+
+  // Lower bound on the edit distance between the query and the candidate
+  [[nodiscard]] uint32_t
+  distance_lower_bound(const Core::UnicodeString &candidate) const noexcept;
+
+  // True when the candidate could still be within max_distance of the query
+  [[nodiscard]] bool can_reach(const Core::UnicodeString &candidate,
+                               uint32_t max_distance) const noexcept;
+
+private:
+  // Codepoints are folded into a fixed number of buckets so the histogram
+  // stays O(1) regardless of the alphabet; merging characters into a shared
+  // bucket only weakens the bound, never invalidates it
+  static constexpr size_t BUCKET_COUNT = 256;
+
+  [[nodiscard]] size_t bucket(char32_t c) const noexcept;
+
+  size_t query_length_;
+  bool case_sensitive_;
+  std::array<uint32_t, BUCKET_COUNT> histogram_{};
+};
+
+} // namespace TextSimilarity::Engine
@@ -0,0 +1,173 @@
+#include "prepared_cache.hpp"
+#include "../algorithms/token_based.hpp"
+#include <algorithm>
+
+namespace TextSimilarity::Engine {
+
+PreparedFormCache::PreparedFormCache(size_t capacity) {
+  shards_.reserve(SHARD_COUNT);
+  for (size_t i = 0; i < SHARD_COUNT; ++i) {
+    shards_.push_back(std::make_unique<Shard>());
+  }
+
+  shard_capacity_ = std::max<size_t>(1, capacity / SHARD_COUNT);
+}
+
+uint64_t PreparedFormCache::make_key(std::string_view text,
+                                     const Core::AlgorithmConfig &config,
+                                     StateKind kind) noexcept {
+  // FNV-1a, same construction as the engine's pair-result key but over a
+  // single string; 0xFF separators keep field boundaries unambiguous
+  uint64_t hash = 14695981039346656037ULL;
+  constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+  auto hash_byte = [&hash](uint8_t byte) {
+    hash ^= byte;
+    hash *= FNV_PRIME;
+  };
+
+  hash_byte(static_cast<uint8_t>(kind));
+  hash_byte(0xFF);
+  hash_byte(static_cast<uint8_t>(config.preprocessing));
+  hash_byte(0xFF);
+  hash_byte(static_cast<uint8_t>(config.case_sensitivity));
+  hash_byte(0xFF);
+  hash_byte(static_cast<uint8_t>(config.ngram_size));
+  hash_byte(0xFF);
+
+  for (char c : text) {
+    hash_byte(static_cast<uint8_t>(c));
+  }
+
+  return hash;
+}
+
+std::shared_ptr<const PreparedForm> PreparedFormCache::get(uint64_t key) const {
+  Shard &shard = select_shard(key);
+
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+  auto it = shard.index.find(key);
+  if (it == shard.index.end()) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  // Second-chance bit; safe under the shared lock because it is atomic
+  Slot &slot = shard.slots[it->second];
+  slot.referenced.store(true, std::memory_order_relaxed);
+
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  return slot.form;
+}
+
+void PreparedFormCache::put(uint64_t key,
+                            std::shared_ptr<const PreparedForm> form) {
+  const size_t footprint = estimate_footprint(*form);
+  Shard &shard = select_shard(key);
+
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+  auto it = shard.index.find(key);
+  if (it != shard.index.end()) {
+    // Lost a race with another thread preparing the same string; the
+    // existing form is equivalent, keep it
+    shard.slots[it->second].referenced.store(true, std::memory_order_relaxed);
+    return;
+  }
+
+  if (shard.slots.size() < shard_capacity_) {
+    shard.index.emplace(key, shard.slots.size());
+    shard.slots.emplace_back(key, std::move(form), footprint);
+    return;
+  }
+
+  // CLOCK eviction: sweep until a slot without a recent reference is found.
+  // Terminates within two passes because each visit clears the bit.
+  for (;;) {
+    Slot &candidate = shard.slots[shard.clock_hand];
+    if (candidate.referenced.exchange(false, std::memory_order_relaxed)) {
+      shard.clock_hand = (shard.clock_hand + 1) % shard.slots.size();
+      continue;
+    }
+
+    shard.index.erase(candidate.key);
+    shard.index.emplace(key, shard.clock_hand);
+    candidate.key = key;
+    candidate.form = std::move(form);
+    candidate.footprint = footprint;
+    candidate.referenced.store(true, std::memory_order_relaxed);
+    shard.clock_hand = (shard.clock_hand + 1) % shard.slots.size();
+
+    evictions_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+}
+
+void PreparedFormCache::clear() noexcept {
+  for (auto &shard : shards_) {
+    std::unique_lock<std::shared_mutex> lock(shard->mutex);
+    shard->index.clear();
+    shard->slots.clear();
+    shard->clock_hand = 0;
+  }
+}
+
+Core::CacheStatistics PreparedFormCache::get_statistics() const noexcept {
+  Core::CacheStatistics stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  stats.evictions = evictions_.load(std::memory_order_relaxed);
+  stats.entries = size();
+  stats.capacity = shard_capacity_ * SHARD_COUNT;
+  return stats;
+}
+
+void PreparedFormCache::reset_statistics() noexcept {
+  hits_.store(0, std::memory_order_relaxed);
+  misses_.store(0, std::memory_order_relaxed);
+  evictions_.store(0, std::memory_order_relaxed);
+}
+
+size_t PreparedFormCache::size() const noexcept {
+  size_t total = 0;
+  for (const auto &shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard->mutex);
+    total += shard->slots.size();
+  }
+  return total;
+}
+
+size_t PreparedFormCache::memory_usage() const noexcept {
+  size_t total = 0;
+  for (const auto &shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard->mutex);
+    for (const auto &slot : shard->slots) {
+      total += sizeof(Slot) + sizeof(uint64_t) + sizeof(size_t) +
+               slot.footprint;
+    }
+  }
+  return total;
+}
+
+PreparedFormCache::Shard &
+PreparedFormCache::select_shard(uint64_t key) const noexcept {
+  // Shard on the upper bits; the lower bits already drive the unordered_map
+  // bucket selection inside the shard
+  return *shards_[(key >> 56) & (SHARD_COUNT - 1)];
+}
+
+size_t PreparedFormCache::estimate_footprint(const PreparedForm &form) {
+  // UTF-8 bytes plus the materialized UTF-32 copy plus the token counter's
+  // entry run when present; container headers are covered by sizeof(Slot)
+  size_t bytes = form.processed.utf8().capacity() +
+                 form.processed.length() * sizeof(char32_t);
+  if (form.token_state) {
+    const auto &counter =
+        *static_cast<const Algorithms::FlatCounter *>(form.token_state.get());
+    bytes += counter.size() * sizeof(Algorithms::FlatCounter::Entry);
+  }
+  return bytes;
+}
+
+} // namespace TextSimilarity::Engine
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "../core/types.hpp"
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace TextSimilarity::Engine {
+
+// One cached intermediate form of a single input string: the preprocessed
+// UnicodeString (UTF-32 form already materialized, so shared readers never
+// race on the lazy conversion) and, for token algorithms, the coalesced
+// token counter ready to be adopted into a prepared query.
+struct PreparedForm {
+  Core::UnicodeString processed;
+  std::shared_ptr<void> token_state; // Algorithms::FlatCounter when present
+
+  PreparedForm(Core::UnicodeString p, std::shared_ptr<void> s)
+      : processed(std::move(p)), token_state(std::move(s)) {}
+};
+
+// Second cache tier below the pair-result cache: maps one string (plus the
+// preprocessing bits of the configuration that shape its prepared form) to
+// that form, so a string repeated across many pairs pays for Unicode
+// validation, case folding and tokenization once even when each *pair* is
+// new. Entries are shared across algorithms whose preprocessing agrees.
+//
+// Same sharded CLOCK design as ResultCache; values are shared_ptrs so a hit
+// stays valid after a concurrent eviction drops the slot.
+class PreparedFormCache {
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 4096;
+  static constexpr size_t SHARD_COUNT = 16; // Power of two for mask selection
+
+  // Discriminates the algorithm-specific part of the form; forms with
+  // different kinds never alias even for identical text and configuration
+  enum class StateKind : uint8_t {
+    None = 0,    // Preprocessed string only (edit-distance, vector, phonetic)
+    TokenCounts, // FlatCounter keeping multiplicities
+    TokenSet     // FlatCounter clamped to set semantics (word-mode Jaccard)
+  };
+
+  explicit PreparedFormCache(size_t capacity = DEFAULT_CAPACITY);
+
+  // Non-copyable, non-movable
+  PreparedFormCache(const PreparedFormCache &) = delete;
+  PreparedFormCache &operator=(const PreparedFormCache &) = delete;
+  PreparedFormCache(PreparedFormCache &&) = delete;
+  PreparedFormCache &operator=(PreparedFormCache &&) = delete;
+
+  // Key over the raw input bytes and every configuration field that changes
+  // the prepared form; fields the form does not depend on (threshold,
+  // alpha/beta, ...) are deliberately excluded so they do not fragment it
+  [[nodiscard]] static uint64_t make_key(std::string_view text,
+                                         const Core::AlgorithmConfig &config,
+                                         StateKind kind) noexcept;
+
+  [[nodiscard]] std::shared_ptr<const PreparedForm> get(uint64_t key) const;
+  void put(uint64_t key, std::shared_ptr<const PreparedForm> form);
+
+  void clear() noexcept;
+
+  [[nodiscard]] Core::CacheStatistics get_statistics() const noexcept;
+  void reset_statistics() noexcept;
+  [[nodiscard]] size_t size() const noexcept;
+  [[nodiscard]] size_t memory_usage() const noexcept;
+
+private:
+  struct Slot {
+    uint64_t key;
+    std::shared_ptr<const PreparedForm> form;
+    size_t footprint; // Estimated bytes, computed once at insertion
+    std::atomic<bool> referenced;
+
+    Slot(uint64_t k, std::shared_ptr<const PreparedForm> f, size_t bytes)
+        : key(k), form(std::move(f)), footprint(bytes), referenced(true) {}
+  };
+
+  struct Shard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<uint64_t, size_t> index; // key -> slot position
+    std::deque<Slot> slots; // deque: growth never moves existing slots
+    size_t clock_hand{0};
+  };
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+  size_t shard_capacity_;
+
+  // Counters are cache-wide; relaxed ordering is sufficient for statistics
+  mutable std::atomic<size_t> hits_{0};
+  mutable std::atomic<size_t> misses_{0};
+  mutable std::atomic<size_t> evictions_{0};
+
+  [[nodiscard]] Shard &select_shard(uint64_t key) const noexcept;
+  [[nodiscard]] static size_t estimate_footprint(const PreparedForm &form);
+};
+
+} // namespace TextSimilarity::Engine
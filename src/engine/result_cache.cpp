@@ -0,0 +1,135 @@
+#include "result_cache.hpp"
+#include <algorithm>
+
+namespace TextSimilarity::Engine {
+
+ResultCache::ResultCache(size_t capacity) {
+  shards_.reserve(SHARD_COUNT);
+  for (size_t i = 0; i < SHARD_COUNT; ++i) {
+    shards_.push_back(std::make_unique<Shard>());
+  }
+
+  shard_capacity_ = std::max<size_t>(1, capacity / SHARD_COUNT);
+}
+
+std::optional<double> ResultCache::get(CacheKey key) const {
+  Shard &shard = select_shard(key.key);
+
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+  auto it = shard.index.find(key.key);
+  if (it == shard.index.end()) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+  }
+
+  Slot &slot = shard.slots[it->second];
+  if (slot.check != key.check) {
+    // Primary-hash collision with a different entry; reporting a miss here
+    // is the whole point of storing the second hash
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+  }
+
+  // Second-chance bit; safe under the shared lock because it is atomic
+  slot.referenced.store(true, std::memory_order_relaxed);
+
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  return slot.value;
+}
+
+void ResultCache::put(CacheKey key, double value) {
+  Shard &shard = select_shard(key.key);
+
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+  auto it = shard.index.find(key.key);
+  if (it != shard.index.end()) {
+    // Same primary key: refresh the slot, taking over from the colliding
+    // entry when the check hashes differ
+    Slot &slot = shard.slots[it->second];
+    slot.check = key.check;
+    slot.value = value;
+    slot.referenced.store(true, std::memory_order_relaxed);
+    return;
+  }
+
+  if (shard.slots.size() < shard_capacity_) {
+    shard.index.emplace(key.key, shard.slots.size());
+    shard.slots.emplace_back(key, value);
+    return;
+  }
+
+  // CLOCK eviction: sweep until a slot without a recent reference is found.
+  // Terminates within two passes because each visit clears the bit.
+  for (;;) {
+    Slot &candidate = shard.slots[shard.clock_hand];
+    if (candidate.referenced.exchange(false, std::memory_order_relaxed)) {
+      shard.clock_hand = (shard.clock_hand + 1) % shard.slots.size();
+      continue;
+    }
+
+    shard.index.erase(candidate.key);
+    shard.index.emplace(key.key, shard.clock_hand);
+    candidate.key = key.key;
+    candidate.check = key.check;
+    candidate.value = value;
+    candidate.referenced.store(true, std::memory_order_relaxed);
+    shard.clock_hand = (shard.clock_hand + 1) % shard.slots.size();
+
+    evictions_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+}
+
+void ResultCache::set_capacity(size_t capacity) {
+  shard_capacity_ = std::max<size_t>(1, capacity / SHARD_COUNT);
+  clear();
+}
+
+void ResultCache::clear() noexcept {
+  for (auto &shard : shards_) {
+    std::unique_lock<std::shared_mutex> lock(shard->mutex);
+    shard->index.clear();
+    shard->slots.clear();
+    shard->clock_hand = 0;
+  }
+}
+
+Core::CacheStatistics ResultCache::get_statistics() const noexcept {
+  Core::CacheStatistics stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  stats.evictions = evictions_.load(std::memory_order_relaxed);
+  stats.entries = size();
+  stats.capacity = shard_capacity_ * SHARD_COUNT;
+  return stats;
+}
+
+void ResultCache::reset_statistics() noexcept {
+  hits_.store(0, std::memory_order_relaxed);
+  misses_.store(0, std::memory_order_relaxed);
+  evictions_.store(0, std::memory_order_relaxed);
+}
+
+size_t ResultCache::size() const noexcept {
+  size_t total = 0;
+  for (const auto &shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard->mutex);
+    total += shard->slots.size();
+  }
+  return total;
+}
+
+size_t ResultCache::memory_usage() const noexcept {
+  // Rough estimate: slot storage plus index overhead per entry
+  return size() * (sizeof(Slot) + sizeof(uint64_t) + sizeof(size_t));
+}
+
+ResultCache::Shard &ResultCache::select_shard(uint64_t key) const noexcept {
+  // Shard on the upper bits; the lower bits already drive the unordered_map
+  // bucket selection inside the shard
+  return *shards_[(key >> 56) & (SHARD_COUNT - 1)];
+}
+
+} // namespace TextSimilarity::Engine
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "../core/types.hpp"
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace TextSimilarity::Engine {
+
+// 128-bit cache identity computed by the caller: `key` selects the shard
+// and slot, `check` is a second, independently computed hash of the same
+// inputs that is stored alongside the value and verified on lookup. A
+// collision on one hash then reads as a miss instead of silently returning
+// a different string pair's score, while lookups still never build a
+// concatenated string key.
+struct CacheKey {
+  uint64_t key;
+  uint64_t check;
+};
+
+// Sharded result cache with CLOCK eviction
+//
+// Keys are hashes computed by the caller, so lookups never build a
+// concatenated string key. Entries are spread across independent shards
+// selected from the key hash; reads take a per-shard shared lock and only
+// touch an atomic reference bit, so concurrent lookups on different keys do
+// not serialize. Eviction uses the CLOCK second-chance policy instead of a
+// TTL sweep: a victim is found in O(1) amortized time without sorting the
+// whole shard.
+class ResultCache {
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 10000;
+  static constexpr size_t SHARD_COUNT = 16; // Power of two for mask selection
+
+  explicit ResultCache(size_t capacity = DEFAULT_CAPACITY);
+
+  // Non-copyable, non-movable
+  ResultCache(const ResultCache &) = delete;
+  ResultCache &operator=(const ResultCache &) = delete;
+  ResultCache(ResultCache &&) = delete;
+  ResultCache &operator=(ResultCache &&) = delete;
+
+  [[nodiscard]] std::optional<double> get(CacheKey key) const;
+  void put(CacheKey key, double value);
+
+  // Changing the capacity discards all entries; it is intended to be called
+  // once at configuration time, not on the hot path
+  void set_capacity(size_t capacity);
+
+  void clear() noexcept;
+
+  [[nodiscard]] Core::CacheStatistics get_statistics() const noexcept;
+  void reset_statistics() noexcept;
+  [[nodiscard]] size_t size() const noexcept;
+  [[nodiscard]] size_t memory_usage() const noexcept;
+
+private:
+  struct Slot {
+    uint64_t key;
+    uint64_t check; // Verified on lookup; a mismatch is a hash collision
+    double value;
+    std::atomic<bool> referenced;
+
+    Slot(CacheKey k, double v)
+        : key(k.key), check(k.check), value(v), referenced(true) {}
+  };
+
+  struct Shard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<uint64_t, size_t> index; // key -> slot position
+    std::deque<Slot> slots; // deque: growth never moves existing slots
+    size_t clock_hand{0};
+  };
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+  size_t shard_capacity_;
+
+  // Counters are cache-wide; relaxed ordering is sufficient for statistics
+  mutable std::atomic<size_t> hits_{0};
+  mutable std::atomic<size_t> misses_{0};
+  mutable std::atomic<size_t> evictions_{0};
+
+  [[nodiscard]] Shard &select_shard(uint64_t key) const noexcept;
+};
+
+} // namespace TextSimilarity::Engine
@@ -0,0 +1,262 @@
+#include "shared_result_cache.hpp"
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+#ifdef _WIN32
+// No POSIX shared memory on this platform; the constructor throws and the
+// engine keeps using the in-process cache.
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace TextSimilarity::Engine {
+
+namespace {
+constexpr uint64_t CACHE_MAGIC = 0x5453534843414348ULL; // "TSSHCACH"
+constexpr uint64_t CACHE_VERSION = 1;
+constexpr size_t MIN_SLOTS = 64;
+constexpr size_t PROBE_WINDOW = 8;
+
+// How long an opener waits for a concurrent creator to finish initializing
+// the header before giving up and falling back to the in-process cache
+constexpr auto INIT_TIMEOUT = std::chrono::milliseconds(100);
+
+// Fibonacci hashing spreads the FNV keys across slots; the probe start
+// must not correlate with the victim selection bits
+uint64_t slot_index(uint64_t key, uint64_t mask) noexcept {
+  return (key * 0x9E3779B97F4A7C15ULL) >> 17 & mask;
+}
+
+uint64_t double_to_bits(double value) noexcept {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+double bits_to_double(uint64_t bits) noexcept {
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+std::string normalize_name(const std::string &name) {
+  if (name.empty()) {
+    throw std::invalid_argument("Shared cache name must not be empty");
+  }
+  return name.front() == '/' ? name : "/" + name;
+}
+} // namespace
+
+#ifdef _WIN32
+
+SharedResultCache::SharedResultCache(const std::string &name, size_t)
+    : name_(normalize_name(name)) {
+  throw std::runtime_error(
+      "Shared result cache is not supported on this platform");
+}
+
+SharedResultCache::~SharedResultCache() = default;
+
+void SharedResultCache::remove(const std::string &) noexcept {}
+
+#else
+
+SharedResultCache::SharedResultCache(const std::string &name,
+                                     size_t size_bytes)
+    : name_(normalize_name(name)) {
+  // Largest power-of-two slot count fitting the requested byte budget;
+  // only the creator's geometry matters, later workers adopt it
+  size_t slots = MIN_SLOTS;
+  while (sizeof(Header) + slots * 2 * sizeof(Slot) <= size_bytes) {
+    slots *= 2;
+  }
+  const size_t create_size = sizeof(Header) + slots * sizeof(Slot);
+
+  bool created = false;
+  int fd = ::shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd >= 0) {
+    created = true;
+    if (::ftruncate(fd, static_cast<off_t>(create_size)) != 0) {
+      ::close(fd);
+      ::shm_unlink(name_.c_str());
+      throw std::runtime_error("Cannot size shared cache segment: " + name_);
+    }
+  } else {
+    fd = ::shm_open(name_.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+      throw std::runtime_error("Cannot open shared cache segment: " + name_);
+    }
+  }
+
+  // An opener may race the creator between shm_open and ftruncate; wait
+  // for the segment to reach at least header size
+  struct stat segment_stat {};
+  const auto deadline = std::chrono::steady_clock::now() + INIT_TIMEOUT;
+  while (true) {
+    if (::fstat(fd, &segment_stat) != 0) {
+      ::close(fd);
+      throw std::runtime_error("Cannot stat shared cache segment: " + name_);
+    }
+    if (static_cast<size_t>(segment_stat.st_size) >=
+        sizeof(Header) + MIN_SLOTS * sizeof(Slot)) {
+      break;
+    }
+    if (created || std::chrono::steady_clock::now() >= deadline) {
+      ::close(fd);
+      throw std::runtime_error("Shared cache segment is truncated: " + name_);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  mapping_size_ = static_cast<size_t>(segment_stat.st_size);
+  void *mapping = ::mmap(nullptr, mapping_size_, PROT_READ | PROT_WRITE,
+                         MAP_SHARED, fd, 0);
+  ::close(fd); // the mapping keeps the segment alive
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error("Cannot map shared cache segment: " + name_);
+  }
+  mapping_ = mapping;
+
+  auto *header = static_cast<Header *>(mapping_);
+  if (created) {
+    // Fresh shm pages are zero-filled, so the slots are already empty;
+    // publish the geometry before the magic so openers see it complete
+    header->version = CACHE_VERSION;
+    header->slot_count = slots;
+    header->magic.store(CACHE_MAGIC, std::memory_order_release);
+  } else {
+    while (header->magic.load(std::memory_order_acquire) != CACHE_MAGIC) {
+      if (std::chrono::steady_clock::now() >= deadline) {
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+        throw std::runtime_error(
+            "Shared cache segment was never initialized: " + name_);
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (header->version != CACHE_VERSION ||
+        header->slot_count < MIN_SLOTS ||
+        (header->slot_count & (header->slot_count - 1)) != 0 ||
+        sizeof(Header) + header->slot_count * sizeof(Slot) > mapping_size_) {
+      ::munmap(mapping_, mapping_size_);
+      mapping_ = nullptr;
+      throw std::runtime_error(
+          "Shared cache segment has incompatible layout: " + name_);
+    }
+  }
+
+  slot_count_ = header->slot_count;
+  slot_mask_ = slot_count_ - 1;
+}
+
+SharedResultCache::~SharedResultCache() {
+  if (mapping_ != nullptr) {
+    ::munmap(mapping_, mapping_size_);
+  }
+}
+
+void SharedResultCache::remove(const std::string &name) noexcept {
+  ::shm_unlink(normalize_name(name).c_str());
+}
+
+#endif // _WIN32
+
+SharedResultCache::Slot *SharedResultCache::slots() const noexcept {
+  return reinterpret_cast<Slot *>(static_cast<char *>(mapping_) +
+                                  sizeof(Header));
+}
+
+std::optional<double> SharedResultCache::get(uint64_t key) const {
+  const Slot *table = slots();
+  const uint64_t start = slot_index(key, slot_mask_);
+
+  for (size_t probe = 0; probe < PROBE_WINDOW; ++probe) {
+    const Slot &slot = table[(start + probe) & slot_mask_];
+    const uint64_t tag = slot.tag.load(std::memory_order_acquire);
+    if (tag == 0) {
+      break; // Slots fill front-to-back within the window
+    }
+    const uint64_t bits = slot.value_bits.load(std::memory_order_relaxed);
+    // The tag binds key and value together: a torn pair from a racing
+    // writer fails the check and reads as a miss
+    if ((tag ^ bits) == key) {
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      return bits_to_double(bits);
+    }
+  }
+
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  return std::nullopt;
+}
+
+void SharedResultCache::put(uint64_t key, double value) {
+  Slot *table = slots();
+  const uint64_t start = slot_index(key, slot_mask_);
+  const uint64_t bits = double_to_bits(value);
+
+  size_t victim = start & slot_mask_;
+  for (size_t probe = 0; probe < PROBE_WINDOW; ++probe) {
+    Slot &slot = table[(start + probe) & slot_mask_];
+    const uint64_t tag = slot.tag.load(std::memory_order_acquire);
+    if (tag == 0) {
+      victim = (start + probe) & slot_mask_;
+      break;
+    }
+    if ((tag ^ slot.value_bits.load(std::memory_order_relaxed)) == key) {
+      return; // Results are deterministic per key; nothing to update
+    }
+    if (probe == PROBE_WINDOW - 1) {
+      // Window full: overwrite a key-selected victim so collisions on one
+      // window do not always displace the same entry
+      victim = (start + (key >> 60) % PROBE_WINDOW) & slot_mask_;
+      evictions_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  // Value first, then the tag that validates it; a reader that observes
+  // the new tag is guaranteed the matching value by release/acquire
+  table[victim].value_bits.store(bits, std::memory_order_relaxed);
+  table[victim].tag.store(key ^ bits, std::memory_order_release);
+}
+
+void SharedResultCache::clear() noexcept {
+  Slot *table = slots();
+  for (size_t i = 0; i < slot_count_; ++i) {
+    table[i].tag.store(0, std::memory_order_relaxed);
+    table[i].value_bits.store(0, std::memory_order_relaxed);
+  }
+}
+
+Core::CacheStatistics SharedResultCache::get_statistics() const noexcept {
+  Core::CacheStatistics stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  stats.evictions = evictions_.load(std::memory_order_relaxed);
+  stats.entries = size();
+  stats.capacity = slot_count_;
+  return stats;
+}
+
+void SharedResultCache::reset_statistics() noexcept {
+  hits_.store(0, std::memory_order_relaxed);
+  misses_.store(0, std::memory_order_relaxed);
+  evictions_.store(0, std::memory_order_relaxed);
+}
+
+size_t SharedResultCache::size() const noexcept {
+  const Slot *table = slots();
+  size_t occupied = 0;
+  for (size_t i = 0; i < slot_count_; ++i) {
+    if (table[i].tag.load(std::memory_order_relaxed) != 0) {
+      ++occupied;
+    }
+  }
+  return occupied;
+}
+
+} // namespace TextSimilarity::Engine
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "../core/types.hpp"
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace TextSimilarity::Engine {
+
+// Cross-process result cache backed by POSIX shared memory
+//
+// Cluster deployments load one addon instance per worker, so the in-process
+// ResultCache is duplicated per worker and hot pairs are recomputed in
+// every one of them. This cache maps one named shm object into all workers
+// instead: a fixed-size open-addressed table of (tag, value) slot pairs
+// where the tag stores key XOR value-bits. A slot is a hit only when
+// tag XOR value equals the probed key, so a reader racing a writer sees a
+// mismatched pair as a miss rather than a wrong value — reads and writes
+// are plain atomic loads and stores with no cross-process locks anywhere.
+//
+// Entries never expire; writers overwrite a key-selected victim inside the
+// probe window when it is full, which gives CLOCK-like turnover without
+// shared bookkeeping. The first worker to attach creates and sizes the
+// table, later workers adopt its geometry regardless of their own
+// configuration. Statistics are per-process.
+//
+// Construction throws when shared memory is unavailable (unsupported
+// platform, permissions, a half-initialized segment from a crashed
+// creator); the engine falls back to the in-process cache in that case.
+class SharedResultCache {
+public:
+  static constexpr const char *DEFAULT_NAME = "/text-similarity-cache";
+  static constexpr size_t DEFAULT_SIZE_BYTES = 16 * 1024 * 1024;
+
+  // Attaches to the named segment, creating and initializing it when it
+  // does not exist yet. A leading '/' is prepended to the name if missing.
+  SharedResultCache(const std::string &name, size_t size_bytes);
+  ~SharedResultCache();
+
+  // Non-copyable, non-movable (owns the mapping)
+  SharedResultCache(const SharedResultCache &) = delete;
+  SharedResultCache &operator=(const SharedResultCache &) = delete;
+  SharedResultCache(SharedResultCache &&) = delete;
+  SharedResultCache &operator=(SharedResultCache &&) = delete;
+
+  [[nodiscard]] std::optional<double> get(uint64_t key) const;
+  void put(uint64_t key, double value);
+
+  void clear() noexcept;
+
+  [[nodiscard]] Core::CacheStatistics get_statistics() const noexcept;
+  void reset_statistics() noexcept;
+  [[nodiscard]] size_t size() const noexcept; // Occupied slots (full scan)
+  [[nodiscard]] size_t memory_usage() const noexcept { return mapping_size_; }
+
+  [[nodiscard]] const std::string &name() const noexcept { return name_; }
+  [[nodiscard]] size_t slot_count() const noexcept { return slot_count_; }
+
+  // Removes the named segment from the system; existing mappings stay
+  // valid until the last worker detaches. Used by tests and teardown.
+  static void remove(const std::string &name) noexcept;
+
+private:
+  struct Slot {
+    std::atomic<uint64_t> tag; // key ^ value bits; 0 means empty
+    std::atomic<uint64_t> value_bits;
+  };
+
+  struct Header {
+    std::atomic<uint64_t> magic; // Written last by the creator (release)
+    uint64_t version;
+    uint64_t slot_count;
+    uint64_t reserved[5]; // Pad the header to one cache line
+  };
+
+  [[nodiscard]] Slot *slots() const noexcept;
+
+  std::string name_;
+  void *mapping_{nullptr};
+  size_t mapping_size_{0};
+  size_t slot_count_{0};
+  uint64_t slot_mask_{0};
+
+  // Counters are per-process; relaxed ordering is sufficient for statistics
+  mutable std::atomic<size_t> hits_{0};
+  mutable std::atomic<size_t> misses_{0};
+  mutable std::atomic<size_t> evictions_{0};
+};
+
+} // namespace TextSimilarity::Engine
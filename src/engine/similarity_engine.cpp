@@ -1,19 +1,57 @@
 #include "similarity_engine.hpp"
+#include "../algorithms/token_based.hpp"
 #include "../core/dependency_container.hpp"
+#include "../core/statistics.hpp"
+#include "../index/corpus_index.hpp"
+#include "cascade.hpp"
+#include "incremental_matcher.hpp"
+#include "prefilter.hpp"
 #include <algorithm>
+#include <chrono>
+#include <queue>
+#include <cmath>
 #include <iomanip>
 #include <sstream>
 
 namespace TextSimilarity::Engine {
 
+namespace {
+
+// The prefilter's bounds are only valid for edit-distance metrics, where
+// the threshold in AlgorithmConfig is a maximum distance
+bool algorithm_supports_prefilter(Core::AlgorithmType algorithm) noexcept {
+  return algorithm == Core::AlgorithmType::Levenshtein ||
+         algorithm == Core::AlgorithmType::DamerauLevenshtein;
+}
+
+// Token algorithms score indexed documents straight from the stored
+// fingerprint runs; every other algorithm re-prepares the stored
+// preprocessed text
+bool algorithm_uses_token_fingerprints(Core::AlgorithmType algorithm) noexcept {
+  return algorithm == Core::AlgorithmType::Jaccard ||
+         algorithm == Core::AlgorithmType::SorensenDice ||
+         algorithm == Core::AlgorithmType::Overlap ||
+         algorithm == Core::AlgorithmType::Tversky;
+}
+
+} // namespace
+
 // AsyncExecutor Implementation
 
+thread_local const AsyncExecutor *AsyncExecutor::current_executor_ = nullptr;
+thread_local size_t AsyncExecutor::current_worker_ = 0;
+
 AsyncExecutor::AsyncExecutor(size_t thread_count) {
   thread_count = std::max(static_cast<size_t>(1), thread_count);
-  workers_.reserve(thread_count);
 
+  queues_.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; ++i) {
+    queues_.push_back(std::make_unique<WorkerQueue>());
+  }
+
+  workers_.reserve(thread_count);
   for (size_t i = 0; i < thread_count; ++i) {
-    workers_.emplace_back(&AsyncExecutor::worker_loop, this);
+    workers_.emplace_back(&AsyncExecutor::worker_loop, this, i);
   }
 }
 
@@ -25,31 +63,27 @@ Core::AsyncSimilarityResult AsyncExecutor::calculate_similarity_async(
   auto promise = std::make_shared<std::promise<Core::Result<double>>>();
   auto future = promise->get_future();
 
-  {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    if (shutdown_.load()) {
+  if (shutdown_.load()) {
+    promise->set_value(Core::SimilarityResult{Core::SimilarityError{
+        Core::ErrorCode::ThreadingError, "Executor is shutting down"}});
+    return future;
+  }
+
+  submit([alg = std::shared_ptr<Core::ISimilarityAlgorithm>(
+              std::move(algorithm)),
+          s1 = std::move(s1), s2 = std::move(s2), promise]() {
+    try {
+      auto result = alg->calculate_similarity(s1, s2);
+      promise->set_value(std::move(result));
+    } catch (const std::exception &e) {
+      promise->set_value(Core::SimilarityResult{
+          Core::SimilarityError{Core::ErrorCode::Unknown, e.what()}});
+    } catch (...) {
       promise->set_value(Core::SimilarityResult{Core::SimilarityError{
-          Core::ErrorCode::ThreadingError, "Executor is shutting down"}});
-      return future;
+          Core::ErrorCode::Unknown, "Unknown error occurred"}});
     }
+  });
 
-    task_queue_.emplace([alg = std::shared_ptr<Core::ISimilarityAlgorithm>(
-                             std::move(algorithm)),
-                         s1, s2, promise]() {
-      try {
-        auto result = alg->calculate_similarity(s1, s2);
-        promise->set_value(std::move(result));
-      } catch (const std::exception &e) {
-        promise->set_value(Core::SimilarityResult{
-            Core::SimilarityError{Core::ErrorCode::Unknown, e.what()}});
-      } catch (...) {
-        promise->set_value(Core::SimilarityResult{Core::SimilarityError{
-            Core::ErrorCode::Unknown, "Unknown error occurred"}});
-      }
-    });
-  }
-
-  cv_.notify_one();
   return future;
 }
 
@@ -59,41 +93,124 @@ Core::AsyncDistanceResult AsyncExecutor::calculate_distance_async(
   auto promise = std::make_shared<std::promise<Core::Result<uint32_t>>>();
   auto future = promise->get_future();
 
-  {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    if (shutdown_.load()) {
+  if (shutdown_.load()) {
+    promise->set_value(Core::DistanceResult{Core::SimilarityError{
+        Core::ErrorCode::ThreadingError, "Executor is shutting down"}});
+    return future;
+  }
+
+  submit([alg = std::shared_ptr<Core::ISimilarityAlgorithm>(
+              std::move(algorithm)),
+          s1 = std::move(s1), s2 = std::move(s2), promise]() {
+    try {
+      auto result = alg->calculate_distance(s1, s2);
+      promise->set_value(std::move(result));
+    } catch (const std::exception &e) {
+      promise->set_value(Core::DistanceResult{
+          Core::SimilarityError{Core::ErrorCode::Unknown, e.what()}});
+    } catch (...) {
       promise->set_value(Core::DistanceResult{Core::SimilarityError{
-          Core::ErrorCode::ThreadingError, "Executor is shutting down"}});
-      return future;
+          Core::ErrorCode::Unknown, "Unknown error occurred"}});
     }
+  });
 
-    task_queue_.emplace([alg = std::shared_ptr<Core::ISimilarityAlgorithm>(
-                             std::move(algorithm)),
-                         s1, s2, promise]() {
-      try {
-        auto result = alg->calculate_distance(s1, s2);
-        promise->set_value(std::move(result));
-      } catch (const std::exception &e) {
-        promise->set_value(Core::DistanceResult{
-            Core::SimilarityError{Core::ErrorCode::Unknown, e.what()}});
-      } catch (...) {
-        promise->set_value(Core::DistanceResult{Core::SimilarityError{
-            Core::ErrorCode::Unknown, "Unknown error occurred"}});
+  return future;
+}
+
+AsyncExecutor::Task AsyncExecutor::make_timed(Task task) {
+  return [this, inner = std::move(task),
+          enqueued = std::chrono::steady_clock::now()]() {
+    task_wait_ns_.fetch_add(
+        static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - enqueued)
+                .count()),
+        std::memory_order_relaxed);
+    inner();
+  };
+}
+
+void AsyncExecutor::submit(std::function<void()> task) {
+  if (shutdown_.load()) {
+    // Executor is draining; run inline so callers waiting on the task
+    // cannot deadlock
+    task();
+    return;
+  }
+
+  task = make_timed(std::move(task));
+
+  // Affinity: a task submitted from a worker thread goes to the front of
+  // that worker's own deque, keeping small follow-up tasks on a warm cache;
+  // external threads spread round-robin across the deque backs
+  if (current_executor_ == this) {
+    push_task(current_worker_, std::move(task), /*to_front=*/true);
+  } else {
+    const size_t target = next_queue_.fetch_add(1, std::memory_order_relaxed) %
+                          queues_.size();
+    push_task(target, std::move(task), /*to_front=*/false);
+  }
+}
+
+void AsyncExecutor::submit_batch(std::vector<std::function<void()>> tasks) {
+  if (tasks.empty()) {
+    return;
+  }
+
+  if (shutdown_.load()) {
+    for (auto &task : tasks) {
+      task();
+    }
+    return;
+  }
+
+  // One lock acquisition per worker queue instead of one per task
+  const size_t queue_count = queues_.size();
+  const size_t chunk = (tasks.size() + queue_count - 1) / queue_count;
+  const size_t first =
+      next_queue_.fetch_add(1, std::memory_order_relaxed) % queue_count;
+
+  size_t task_index = 0;
+  for (size_t offset = 0; offset < queue_count && task_index < tasks.size();
+       ++offset) {
+    auto &queue = *queues_[(first + offset) % queue_count];
+    const size_t slice_end = std::min(task_index + chunk, tasks.size());
+    const size_t slice_size = slice_end - task_index;
+
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      for (; task_index < slice_end; ++task_index) {
+        queue.tasks.push_back(make_timed(std::move(tasks[task_index])));
       }
-    });
+    }
+
+    pending_.fetch_add(slice_size, std::memory_order_relaxed);
+    queue.cv.notify_one();
   }
+}
 
-  cv_.notify_one();
-  return future;
+Core::ExecutorStatistics AsyncExecutor::get_statistics() const noexcept {
+  Core::ExecutorStatistics stats;
+  stats.worker_count = workers_.size();
+  stats.pending_tasks = pending_.load(std::memory_order_relaxed);
+  stats.executed_tasks = executed_.load(std::memory_order_relaxed);
+  stats.steals = steals_.load(std::memory_order_relaxed);
+  stats.task_wait_ns = task_wait_ns_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void AsyncExecutor::reset_statistics() noexcept {
+  executed_.store(0, std::memory_order_relaxed);
+  steals_.store(0, std::memory_order_relaxed);
+  task_wait_ns_.store(0, std::memory_order_relaxed);
 }
 
 void AsyncExecutor::shutdown() noexcept {
-  {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    shutdown_.store(true);
-  }
+  shutdown_.store(true);
 
-  cv_.notify_all();
+  for (auto &queue : queues_) {
+    queue->cv.notify_all();
+  }
 
   for (auto &worker : workers_) {
     if (worker.joinable()) {
@@ -102,31 +219,92 @@ void AsyncExecutor::shutdown() noexcept {
   }
 
   workers_.clear();
+
+  for (auto &queue : queues_) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->tasks.clear();
+  }
+  pending_.store(0);
 }
 
-void AsyncExecutor::worker_loop() {
+void AsyncExecutor::worker_loop(size_t index) {
+  current_executor_ = this;
+  current_worker_ = index;
+
+  auto &own_queue = *queues_[index];
+
   while (!shutdown_.load()) {
-    Task task{[]() {}};
+    Task task;
 
-    {
-      std::unique_lock<std::mutex> lock(queue_mutex_);
-      cv_.wait(lock,
-               [this] { return shutdown_.load() || !task_queue_.empty(); });
+    if (try_pop_own(index, task) || try_steal(index, task)) {
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      task();
+      executed_.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
 
-      if (shutdown_.load()) {
-        break;
-      }
+    // Nothing local and nothing to steal: sleep on the own queue's
+    // condition variable. The timed wait is a backstop so a backlog on
+    // another worker's deque is noticed even without an explicit wake.
+    std::unique_lock<std::mutex> lock(own_queue.mutex);
+    own_queue.cv.wait_for(lock, std::chrono::milliseconds(1), [this, &own_queue] {
+      return shutdown_.load() || !own_queue.tasks.empty() ||
+             pending_.load(std::memory_order_relaxed) > 0;
+    });
+  }
 
-      if (!task_queue_.empty()) {
-        task = std::move(task_queue_.front());
-        task_queue_.pop();
-      }
+  current_executor_ = nullptr;
+}
+
+bool AsyncExecutor::try_pop_own(size_t index, Task &task) {
+  auto &queue = *queues_[index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+
+  if (queue.tasks.empty()) {
+    return false;
+  }
+
+  task = std::move(queue.tasks.front());
+  queue.tasks.pop_front();
+  return true;
+}
+
+bool AsyncExecutor::try_steal(size_t thief, Task &task) {
+  const size_t queue_count = queues_.size();
+
+  for (size_t offset = 1; offset < queue_count; ++offset) {
+    auto &victim = *queues_[(thief + offset) % queue_count];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+
+    if (victim.tasks.empty()) {
+      continue;
     }
 
-    if (task.work) {
-      task.work();
+    // Steal from the opposite end of the one the owner works, so thief and
+    // owner rarely contend for the same task
+    task = std::move(victim.tasks.back());
+    victim.tasks.pop_back();
+    steals_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  return false;
+}
+
+void AsyncExecutor::push_task(size_t index, Task task, bool to_front) {
+  auto &queue = *queues_[index];
+
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (to_front) {
+      queue.tasks.push_front(std::move(task));
+    } else {
+      queue.tasks.push_back(std::move(task));
     }
   }
+
+  pending_.fetch_add(1, std::memory_order_relaxed);
+  queue.cv.notify_one();
 }
 
 // ConfigurationManager Implementation
@@ -177,6 +355,113 @@ ConfigurationManager::get_default_config() const noexcept {
   return config;
 }
 
+// SimilaritySession Implementation
+
+SimilaritySession::SimilaritySession(
+    std::unique_ptr<Core::ISimilarityAlgorithm> algorithm,
+    Core::AlgorithmConfig config)
+    : algorithm_(std::move(algorithm)), config_(std::move(config)),
+      max_string_length_(config_.max_string_length.value_or(100000)) {}
+
+Core::SimilarityResult
+SimilaritySession::calculate_similarity(const std::string &s1,
+                                        const std::string &s2) {
+  if (!validate_input(s1, s2)) {
+    return Core::SimilarityResult{Core::SimilarityError{
+        Core::ErrorCode::InvalidInput, "Invalid input strings"}};
+  }
+
+  try {
+    Core::UnicodeString us1(s1);
+    Core::UnicodeString us2(s2);
+    return algorithm_->calculate_similarity(us1, us2);
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::Unknown, e.what()}};
+  }
+}
+
+Core::DistanceResult
+SimilaritySession::calculate_distance(const std::string &s1,
+                                      const std::string &s2) {
+  if (!validate_input(s1, s2)) {
+    return Core::DistanceResult{Core::SimilarityError{
+        Core::ErrorCode::InvalidInput, "Invalid input strings"}};
+  }
+
+  try {
+    Core::UnicodeString us1(s1);
+    Core::UnicodeString us2(s2);
+    return algorithm_->calculate_distance(us1, us2);
+  } catch (const std::exception &e) {
+    return Core::DistanceResult{
+        Core::SimilarityError{Core::ErrorCode::Unknown, e.what()}};
+  }
+}
+
+Core::AlgorithmType SimilaritySession::get_algorithm_type() const noexcept {
+  return algorithm_->get_algorithm_type();
+}
+
+Core::AlgorithmConfig SimilaritySession::get_configuration() const {
+  return config_;
+}
+
+bool SimilaritySession::validate_input(const std::string &s1,
+                                       const std::string &s2) const noexcept {
+  return s1.length() <= max_string_length_ && s2.length() <= max_string_length_;
+}
+
+// DocumentProfile Implementation
+
+DocumentProfile::DocumentProfile(
+    std::shared_ptr<Core::ISimilarityAlgorithm> algorithm,
+    Core::AlgorithmConfig config, const std::string &text)
+    : algorithm_(std::move(algorithm)), config_(std::move(config)),
+      prepared_(algorithm_->prepare_query(Core::UnicodeString{text})) {}
+
+Core::SimilarityResult
+DocumentProfile::similarity_to(const Core::IDocumentProfile &other) const {
+  const auto *other_profile = dynamic_cast<const DocumentProfile *>(&other);
+  if (!other_profile) {
+    return Core::SimilarityResult{Core::SimilarityError{
+        Core::ErrorCode::InvalidInput, "Unknown profile implementation"}};
+  }
+
+  if (other_profile->get_algorithm_type() != get_algorithm_type()) {
+    return Core::SimilarityResult{Core::SimilarityError{
+        Core::ErrorCode::InvalidConfiguration,
+        "Profiles were created for different algorithms"}};
+  }
+
+  try {
+    return algorithm_->calculate_similarity_profiles(
+        *prepared_, *other_profile->prepared_);
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::Unknown, e.what()}};
+  }
+}
+
+Core::SimilarityResult
+DocumentProfile::similarity_to_text(const std::string &text) const {
+  try {
+    return algorithm_->calculate_similarity_prepared(*prepared_,
+                                                     Core::UnicodeString{text});
+  } catch (const std::exception &e) {
+    return Core::SimilarityResult{
+        Core::SimilarityError{Core::ErrorCode::Unknown, e.what()}};
+  }
+}
+
+Core::AlgorithmType DocumentProfile::get_algorithm_type() const noexcept {
+  return algorithm_->get_algorithm_type();
+}
+
+Core::AlgorithmConfig DocumentProfile::get_configuration() const {
+  return config_;
+}
+
 // SimilarityEngine Implementation
 
 SimilarityEngine::SimilarityEngine(
@@ -194,7 +479,7 @@ SimilarityEngine::SimilarityEngine(
 SimilarityEngine::~SimilarityEngine() { shutdown(); }
 
 Core::SimilarityResult SimilarityEngine::calculate_similarity(
-    const std::string &s1, const std::string &s2, Core::AlgorithmType algorithm,
+    std::string_view s1, std::string_view s2, Core::AlgorithmType algorithm,
     const Core::AlgorithmConfig &config) {
   total_operations_.fetch_add(1, std::memory_order_relaxed);
 
@@ -223,15 +508,49 @@ Core::SimilarityResult SimilarityEngine::calculate_similarity(
       return Core::SimilarityResult{*cached};
     }
 
-    // Create Unicode strings
-    Core::UnicodeString us1(s1);
-    Core::UnicodeString us2(s2);
+    // Per-string prepared forms: a string repeated across many pairs pays
+    // for Unicode validation, case folding and tokenization once
+    auto form1 = get_prepared_form(s1, algorithm, final_config);
+    auto form2 = get_prepared_form(s2, algorithm, final_config);
+
+    // Cheap rejection before the full DP: when a pair provably cannot stay
+    // within the distance threshold, report the banded DP's capped sentinel
+    // (threshold + 1) without creating an algorithm instance
+    if (final_config.threshold.has_value() &&
+        algorithm_supports_prefilter(algorithm)) {
+      prefilter_considered_.fetch_add(1, std::memory_order_relaxed);
+
+      const auto max_distance = static_cast<uint32_t>(*final_config.threshold);
+      CandidatePrefilter prefilter(form1->processed,
+                                   final_config.case_sensitivity ==
+                                       Core::CaseSensitivity::Sensitive);
+      if (!prefilter.can_reach(form2->processed, max_distance)) {
+        prefilter_skipped_.fetch_add(1, std::memory_order_relaxed);
+        const size_t max_len =
+            std::max(form1->processed.length(), form2->processed.length());
+        return Core::SimilarityResult{
+            1.0 - static_cast<double>(max_distance + 1) /
+                      static_cast<double>(max_len)};
+      }
+    }
 
     // Create algorithm instance
     auto algo = factory_->create_algorithm(algorithm, final_config);
 
-    // Perform calculation
-    auto result = algo->calculate_similarity(us1, us2);
+    // Perform calculation; token algorithms score the cached counters
+    // directly instead of re-tokenizing
+    Core::SimilarityResult result{0.0};
+    if (form1->token_state && form2->token_state) {
+      auto prepared1 =
+          algo->adopt_prepared_state(form1->processed, form1->token_state);
+      auto prepared2 =
+          algo->adopt_prepared_state(form2->processed, form2->token_state);
+      result = algo->calculate_similarity_profiles(*prepared1, *prepared2);
+    } else {
+      // preprocess_string is idempotent, so handing the algorithm the
+      // processed forms is equivalent to the raw inputs
+      result = algo->calculate_similarity(form1->processed, form2->processed);
+    }
 
     // Cache result if successful
     if (result.is_success()) {
@@ -247,7 +566,7 @@ Core::SimilarityResult SimilarityEngine::calculate_similarity(
 }
 
 Core::DistanceResult SimilarityEngine::calculate_distance(
-    const std::string &s1, const std::string &s2, Core::AlgorithmType algorithm,
+    std::string_view s1, std::string_view s2, Core::AlgorithmType algorithm,
     const Core::AlgorithmConfig &config) {
   total_operations_.fetch_add(1, std::memory_order_relaxed);
 
@@ -267,11 +586,28 @@ Core::DistanceResult SimilarityEngine::calculate_distance(
       final_config = merge_configs(final_config, config, algorithm);
     }
 
-    Core::UnicodeString us1(s1);
-    Core::UnicodeString us2(s2);
+    // Distance reuses the same cached forms as the similarity path
+    auto form1 = get_prepared_form(s1, algorithm, final_config);
+    auto form2 = get_prepared_form(s2, algorithm, final_config);
+
+    // Same prefilter as the similarity path; the capped distance matches
+    // what the banded DP returns when the threshold is exceeded
+    if (final_config.threshold.has_value() &&
+        algorithm_supports_prefilter(algorithm)) {
+      prefilter_considered_.fetch_add(1, std::memory_order_relaxed);
+
+      const auto max_distance = static_cast<uint32_t>(*final_config.threshold);
+      CandidatePrefilter prefilter(form1->processed,
+                                   final_config.case_sensitivity ==
+                                       Core::CaseSensitivity::Sensitive);
+      if (!prefilter.can_reach(form2->processed, max_distance)) {
+        prefilter_skipped_.fetch_add(1, std::memory_order_relaxed);
+        return Core::DistanceResult{max_distance + 1};
+      }
+    }
 
     auto algo = factory_->create_algorithm(algorithm, final_config);
-    return algo->calculate_distance(us1, us2);
+    return algo->calculate_distance(form1->processed, form2->processed);
 
   } catch (const std::exception &e) {
     return Core::DistanceResult{
@@ -349,21 +685,658 @@ SimilarityEngine::calculate_distance_async(std::string s1, std::string s2,
 std::vector<Core::SimilarityResult>
 SimilarityEngine::calculate_similarity_batch(
     const std::vector<std::pair<std::string, std::string>> &pairs,
+    Core::AlgorithmType algorithm, const Core::AlgorithmConfig &config,
+    size_t concurrency) {
+  const size_t pair_count = pairs.size();
+  if (pair_count == 0) {
+    return {};
+  }
+
+  size_t worker_count =
+      concurrency > 0 ? concurrency : std::thread::hardware_concurrency();
+  worker_count = std::max(static_cast<size_t>(1),
+                          std::min(worker_count, pair_count));
+
+  // Sequential path for small batches or single-threaded execution
+  if (worker_count == 1 || pair_count < MIN_PARALLEL_BATCH_SIZE) {
+    std::vector<Core::SimilarityResult> results;
+    results.reserve(pair_count);
+
+    for (const auto &[s1, s2] : pairs) {
+      results.push_back(calculate_similarity(s1, s2, algorithm, config));
+    }
+
+    return results;
+  }
+
+  // Pre-sized result slots: each chunk writes a disjoint index range, so no
+  // post-hoc merging or locking is needed
+  std::vector<Core::SimilarityResult> results(pair_count);
+
+  const size_t chunk_size = (pair_count + worker_count - 1) / worker_count;
+
+  std::vector<std::future<void>> chunk_futures;
+  chunk_futures.reserve(worker_count);
+  std::vector<std::function<void()>> chunk_tasks;
+  chunk_tasks.reserve(worker_count);
+
+  for (size_t chunk_begin = 0; chunk_begin < pair_count;
+       chunk_begin += chunk_size) {
+    const size_t chunk_end = std::min(chunk_begin + chunk_size, pair_count);
+
+    auto promise = std::make_shared<std::promise<void>>();
+    chunk_futures.push_back(promise->get_future());
+
+    chunk_tasks.emplace_back([this, &pairs, &results, chunk_begin, chunk_end,
+                              algorithm, config, promise]() {
+      for (size_t i = chunk_begin; i < chunk_end; ++i) {
+        results[i] = calculate_similarity(pairs[i].first, pairs[i].second,
+                                          algorithm, config);
+      }
+      promise->set_value();
+    });
+  }
+
+  // All chunks enter the executor with one synchronization per worker queue
+  executor_->submit_batch(std::move(chunk_tasks));
+
+  for (auto &future : chunk_futures) {
+    future.wait();
+  }
+
+  return results;
+}
+
+std::vector<Core::SimilarityResult> SimilarityEngine::calculate_one_to_many(
+    std::string_view query, const std::vector<std::string_view> &candidates,
     Core::AlgorithmType algorithm, const Core::AlgorithmConfig &config) {
+  total_operations_.fetch_add(candidates.size(), std::memory_order_relaxed);
+
   std::vector<Core::SimilarityResult> results;
-  results.reserve(pairs.size());
+  results.reserve(candidates.size());
+
+  try {
+    auto global_config = config_manager_->get_global_config();
+    auto algorithm_config = config_manager_->get_algorithm_config(algorithm);
+    auto final_config =
+        merge_configs(global_config, algorithm_config, algorithm);
+
+    if (config.algorithm != Core::AlgorithmType::Levenshtein ||
+        config.preprocessing != Core::PreprocessingMode::None) {
+      final_config = merge_configs(final_config, config, algorithm);
+    }
+
+    // Convert and preprocess the query exactly once; every candidate
+    // comparison reuses the prepared form
+    Core::UnicodeString query_string{std::string(query)};
+
+    auto algo = factory_->create_algorithm(algorithm, final_config);
+    auto prepared = algo->prepare_query(query_string);
+
+    // The prefilter is built once from the query and consulted for every
+    // candidate; rejected candidates never reach the full DP
+    std::optional<CandidatePrefilter> prefilter;
+    uint32_t max_distance = 0;
+    if (final_config.threshold.has_value() &&
+        algo->supports_early_termination()) {
+      max_distance = static_cast<uint32_t>(*final_config.threshold);
+      prefilter.emplace(query_string,
+                        final_config.case_sensitivity ==
+                            Core::CaseSensitivity::Sensitive);
+    }
 
-  for (const auto &[s1, s2] : pairs) {
-    results.push_back(calculate_similarity(s1, s2, algorithm, config));
+    for (const auto &candidate : candidates) {
+      if (!validate_input(query, candidate)) {
+        results.push_back(create_validation_error("Invalid input strings"));
+        continue;
+      }
+
+      try {
+        Core::UnicodeString candidate_string{std::string(candidate)};
+
+        if (prefilter.has_value()) {
+          prefilter_considered_.fetch_add(1, std::memory_order_relaxed);
+          if (!prefilter->can_reach(candidate_string, max_distance)) {
+            prefilter_skipped_.fetch_add(1, std::memory_order_relaxed);
+            const size_t max_len =
+                std::max(query_string.length(), candidate_string.length());
+            results.push_back(Core::SimilarityResult{
+                1.0 - static_cast<double>(max_distance + 1) /
+                          static_cast<double>(max_len)});
+            continue;
+          }
+        }
+
+        results.push_back(
+            algo->calculate_similarity_prepared(*prepared, candidate_string));
+      } catch (const std::exception &e) {
+        results.push_back(Core::SimilarityResult{
+            Core::SimilarityError{Core::ErrorCode::Unknown, e.what()}});
+      }
+    }
+
+    return results;
+
+  } catch (const std::exception &e) {
+    // Query-side failure applies to every candidate
+    results.assign(candidates.size(),
+                   Core::SimilarityResult{Core::SimilarityError{
+                       Core::ErrorCode::Unknown, e.what()}});
+    return results;
   }
+}
 
-  return results;
+std::vector<Core::TopKMatch> SimilarityEngine::find_top_k(
+    const std::string &query, const std::vector<std::string> &candidates,
+    size_t k, double min_similarity, Core::AlgorithmType algorithm,
+    const Core::AlgorithmConfig &config) {
+  if (k == 0 || candidates.empty()) {
+    return {};
+  }
+
+  total_operations_.fetch_add(candidates.size(), std::memory_order_relaxed);
+
+  auto global_config = config_manager_->get_global_config();
+  auto algorithm_config = config_manager_->get_algorithm_config(algorithm);
+  auto final_config = merge_configs(global_config, algorithm_config, algorithm);
+
+  if (config.algorithm != Core::AlgorithmType::Levenshtein ||
+      config.preprocessing != Core::PreprocessingMode::None) {
+    final_config = merge_configs(final_config, config, algorithm);
+  }
+
+  // Min-heap keyed on similarity: the top is the current Kth-best score,
+  // which becomes the pruning cutoff once the heap is full
+  auto worse = [](const Core::TopKMatch &a, const Core::TopKMatch &b) {
+    return a.similarity > b.similarity;
+  };
+  std::priority_queue<Core::TopKMatch, std::vector<Core::TopKMatch>,
+                      decltype(worse)>
+      heap(worse);
+
+  try {
+    Core::UnicodeString query_string(query);
+
+    auto algo = factory_->create_algorithm(algorithm, final_config);
+    const bool distance_pruning = algo->supports_early_termination();
+
+    std::unique_ptr<Core::IPreparedQuery> prepared;
+    std::optional<CandidatePrefilter> prefilter;
+    if (distance_pruning) {
+      prefilter.emplace(query_string,
+                        final_config.case_sensitivity ==
+                            Core::CaseSensitivity::Sensitive);
+    } else {
+      prepared = algo->prepare_query(query_string);
+    }
+
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      if (!validate_input(query, candidates[i])) {
+        continue;
+      }
+
+      const double cutoff =
+          (heap.size() == k)
+              ? std::max(min_similarity, heap.top().similarity)
+              : min_similarity;
+
+      try {
+        Core::UnicodeString candidate(candidates[i]);
+        double similarity = 0.0;
+
+        if (distance_pruning) {
+          // Convert the similarity cutoff into a max-distance bound so the
+          // banded DP in compute_distance_with_threshold can bail out early
+          const size_t max_len =
+              std::max(query_string.length(), candidate.length());
+
+          auto candidate_config = final_config;
+          double bound = static_cast<double>(max_len);
+          if (cutoff > 0.0 && max_len > 0) {
+            bound = std::floor((1.0 - cutoff) *
+                               static_cast<double>(max_len));
+            candidate_config.threshold =
+                candidate_config.threshold.has_value()
+                    ? std::min(*candidate_config.threshold, bound)
+                    : bound;
+          }
+
+          // The prefilter rejects candidates that provably cannot beat the
+          // current cutoff before any per-pair DP state is created
+          prefilter_considered_.fetch_add(1, std::memory_order_relaxed);
+          if (!prefilter->can_reach(candidate,
+                                    static_cast<uint32_t>(bound))) {
+            prefilter_skipped_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+          }
+
+          algo->update_configuration(candidate_config);
+          auto distance = algo->calculate_distance(query_string, candidate);
+          if (!distance.is_success() ||
+              static_cast<double>(distance.value()) > bound) {
+            continue; // Pruned: cannot beat the current Kth-best score
+          }
+
+          similarity =
+              (max_len == 0)
+                  ? 1.0
+                  : 1.0 - static_cast<double>(distance.value()) /
+                              static_cast<double>(max_len);
+        } else {
+          auto result = algo->calculate_similarity_prepared(*prepared,
+                                                            candidate);
+          if (!result.is_success()) {
+            continue;
+          }
+          similarity = result.value();
+        }
+
+        if (similarity < min_similarity) {
+          continue;
+        }
+
+        if (heap.size() < k) {
+          heap.push(Core::TopKMatch{i, similarity});
+        } else if (similarity > heap.top().similarity) {
+          heap.pop();
+          heap.push(Core::TopKMatch{i, similarity});
+        }
+      } catch (const std::exception &) {
+        // Skip candidates that fail to convert or compute
+      }
+    }
+  } catch (const std::exception &) {
+    return {};
+  }
+
+  // Drain the min-heap back-to-front so the result is best first
+  std::vector<Core::TopKMatch> matches(heap.size());
+  for (auto it = matches.rbegin(); it != matches.rend(); ++it) {
+    *it = heap.top();
+    heap.pop();
+  }
+
+  return matches;
+}
+
+std::vector<Core::SimilarityResult>
+SimilarityEngine::calculate_one_to_many_indexed(
+    std::string_view query, const Index::CorpusIndex &index,
+    Core::AlgorithmType algorithm, const Core::AlgorithmConfig &config) {
+  const size_t document_count = index.size();
+  total_operations_.fetch_add(document_count, std::memory_order_relaxed);
+
+  std::vector<Core::SimilarityResult> results;
+  results.reserve(document_count);
+
+  try {
+    auto global_config = config_manager_->get_global_config();
+    auto algorithm_config = config_manager_->get_algorithm_config(algorithm);
+    auto final_config =
+        merge_configs(global_config, algorithm_config, algorithm);
+
+    if (config.algorithm != Core::AlgorithmType::Levenshtein ||
+        config.preprocessing != Core::PreprocessingMode::None) {
+      final_config = merge_configs(final_config, config, algorithm);
+    }
+
+    // The stored fingerprints and text were produced under the index's
+    // preprocessing snapshot; queries must tokenize the same way
+    const auto index_config = index.preprocessing_config();
+    final_config.preprocessing = index_config.preprocessing;
+    final_config.case_sensitivity = index_config.case_sensitivity;
+    final_config.ngram_size = index_config.ngram_size;
+
+    Core::UnicodeString query_string{std::string(query)};
+
+    auto algo = factory_->create_algorithm(algorithm, final_config);
+    auto prepared = algo->prepare_query(query_string);
+
+    const bool use_fingerprints = algorithm_uses_token_fingerprints(algorithm);
+    // Word-mode Jaccard compares distinct tokens, so the stored multiset
+    // counts are clamped to set membership on load
+    const bool as_set =
+        algorithm == Core::AlgorithmType::Jaccard &&
+        final_config.preprocessing == Core::PreprocessingMode::Word;
+
+    for (size_t i = 0; i < document_count; ++i) {
+      try {
+        if (use_fingerprints) {
+          auto state = std::make_shared<Algorithms::FlatCounter>(
+              Algorithms::FlatCounter::from_sorted_entries(
+                  index.token_hashes(i), index.token_counts(i),
+                  index.token_entry_count(i), as_set));
+          auto document = algo->adopt_prepared_state(
+              Core::UnicodeString{std::string(index.text(i))},
+              std::move(state));
+          results.push_back(
+              algo->calculate_similarity_profiles(*prepared, *document));
+        } else {
+          // Stored text is already preprocessed; re-running the (idempotent)
+          // preprocessing inside the prepared path is harmless
+          Core::UnicodeString document{std::string(index.text(i))};
+          results.push_back(
+              algo->calculate_similarity_prepared(*prepared, document));
+        }
+      } catch (const std::exception &e) {
+        results.push_back(Core::SimilarityResult{
+            Core::SimilarityError{Core::ErrorCode::Unknown, e.what()}});
+      }
+    }
+
+    return results;
+
+  } catch (const std::exception &e) {
+    // Query-side failure applies to every document
+    results.assign(document_count,
+                   Core::SimilarityResult{Core::SimilarityError{
+                       Core::ErrorCode::Unknown, e.what()}});
+    return results;
+  }
+}
+
+std::vector<Core::TopKMatch> SimilarityEngine::find_top_k_indexed(
+    std::string_view query, const Index::CorpusIndex &index, size_t k,
+    double min_similarity, Core::AlgorithmType algorithm,
+    const Core::AlgorithmConfig &config) {
+  const size_t document_count = index.size();
+  if (k == 0 || document_count == 0) {
+    return {};
+  }
+
+  total_operations_.fetch_add(document_count, std::memory_order_relaxed);
+
+  // Min-heap keyed on similarity, exactly as in find_top_k: the top is the
+  // current Kth-best score
+  auto worse = [](const Core::TopKMatch &a, const Core::TopKMatch &b) {
+    return a.similarity > b.similarity;
+  };
+  std::priority_queue<Core::TopKMatch, std::vector<Core::TopKMatch>,
+                      decltype(worse)>
+      heap(worse);
+
+  try {
+    auto global_config = config_manager_->get_global_config();
+    auto algorithm_config = config_manager_->get_algorithm_config(algorithm);
+    auto final_config =
+        merge_configs(global_config, algorithm_config, algorithm);
+
+    if (config.algorithm != Core::AlgorithmType::Levenshtein ||
+        config.preprocessing != Core::PreprocessingMode::None) {
+      final_config = merge_configs(final_config, config, algorithm);
+    }
+
+    const auto index_config = index.preprocessing_config();
+    final_config.preprocessing = index_config.preprocessing;
+    final_config.case_sensitivity = index_config.case_sensitivity;
+    final_config.ngram_size = index_config.ngram_size;
+
+    Core::UnicodeString query_string{std::string(query)};
+
+    auto algo = factory_->create_algorithm(algorithm, final_config);
+    auto prepared = algo->prepare_query(query_string);
+
+    const bool use_fingerprints = algorithm_uses_token_fingerprints(algorithm);
+    const bool as_set =
+        algorithm == Core::AlgorithmType::Jaccard &&
+        final_config.preprocessing == Core::PreprocessingMode::Word;
+
+    for (size_t i = 0; i < document_count; ++i) {
+      try {
+        Core::SimilarityResult result{0.0};
+
+        if (use_fingerprints) {
+          auto state = std::make_shared<Algorithms::FlatCounter>(
+              Algorithms::FlatCounter::from_sorted_entries(
+                  index.token_hashes(i), index.token_counts(i),
+                  index.token_entry_count(i), as_set));
+          auto document = algo->adopt_prepared_state(
+              Core::UnicodeString{std::string(index.text(i))},
+              std::move(state));
+          result = algo->calculate_similarity_profiles(*prepared, *document);
+        } else {
+          Core::UnicodeString document{std::string(index.text(i))};
+          result = algo->calculate_similarity_prepared(*prepared, document);
+        }
+
+        if (!result.is_success()) {
+          continue;
+        }
+
+        const double similarity = result.value();
+        if (similarity < min_similarity) {
+          continue;
+        }
+
+        if (heap.size() < k) {
+          heap.push(Core::TopKMatch{i, similarity});
+        } else if (similarity > heap.top().similarity) {
+          heap.pop();
+          heap.push(Core::TopKMatch{i, similarity});
+        }
+      } catch (const std::exception &) {
+        // Skip documents that fail to convert or compute
+      }
+    }
+  } catch (const std::exception &) {
+    return {};
+  }
+
+  // Drain the min-heap back-to-front so the result is best first
+  std::vector<Core::TopKMatch> matches(heap.size());
+  for (auto it = matches.rbegin(); it != matches.rend(); ++it) {
+    *it = heap.top();
+    heap.pop();
+  }
+
+  return matches;
+}
+
+std::vector<double> SimilarityEngine::similarity_matrix(
+    const std::vector<std::string> &strings, Core::AlgorithmType algorithm,
+    const Core::AlgorithmConfig &config, size_t concurrency) {
+  const size_t n = strings.size();
+  if (n == 0) {
+    return {};
+  }
+
+  auto global_config = config_manager_->get_global_config();
+  auto algorithm_config = config_manager_->get_algorithm_config(algorithm);
+  auto final_config = merge_configs(global_config, algorithm_config, algorithm);
+
+  if (config.algorithm != Core::AlgorithmType::Levenshtein ||
+      config.preprocessing != Core::PreprocessingMode::None) {
+    final_config = merge_configs(final_config, config, algorithm);
+  }
+
+  // Convert every string to its Unicode form exactly once; cells reuse the
+  // conversions and the per-row prepared query
+  std::vector<Core::UnicodeString> corpus;
+  corpus.reserve(n);
+  std::vector<bool> valid(n, true);
+  for (size_t i = 0; i < n; ++i) {
+    corpus.emplace_back(strings[i]);
+    valid[i] = validate_input(strings[i], strings[i]);
+
+    // Materialize the lazy UTF-32 form before the corpus is shared across
+    // worker tasks; ASCII strings are consumed via utf8() and stay lazy
+    if (!corpus.back().is_ascii()) {
+      (void)corpus.back().unicode();
+    }
+  }
+
+  const bool symmetric =
+      factory_->create_algorithm(algorithm, final_config)->is_symmetric();
+
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> matrix(n * n, nan);
+
+  total_operations_.fetch_add(symmetric ? (n * (n - 1)) / 2 : n * (n - 1),
+                              std::memory_order_relaxed);
+
+  // Each task owns its algorithm instance and a contiguous block of rows;
+  // for symmetric algorithms only the upper triangle is computed and the
+  // result is mirrored (the mirrored cell has no other writer)
+  auto process_rows = [this, &corpus, &valid, &matrix, n, symmetric, algorithm,
+                       &final_config, nan](size_t row_begin, size_t row_end) {
+    auto algo = factory_->create_algorithm(algorithm, final_config);
+
+    for (size_t i = row_begin; i < row_end; ++i) {
+      matrix[i * n + i] = 1.0;
+      if (!valid[i]) {
+        matrix[i * n + i] = nan;
+        continue;
+      }
+
+      try {
+        auto prepared = algo->prepare_query(corpus[i]);
+
+        const size_t j_begin = symmetric ? i + 1 : 0;
+        for (size_t j = j_begin; j < n; ++j) {
+          if (j == i || !valid[j]) {
+            continue;
+          }
+
+          auto result =
+              algo->calculate_similarity_prepared(*prepared, corpus[j]);
+          const double value = result.is_success() ? result.value() : nan;
+
+          matrix[i * n + j] = value;
+          if (symmetric) {
+            matrix[j * n + i] = value;
+          }
+        }
+      } catch (const std::exception &) {
+        // Row-level failure leaves the row's cells as NaN
+      }
+    }
+  };
+
+  size_t worker_count =
+      concurrency > 0 ? concurrency : std::thread::hardware_concurrency();
+  worker_count = std::max(static_cast<size_t>(1), std::min(worker_count, n));
+
+  const size_t cell_count = symmetric ? (n * (n - 1)) / 2 : n * (n - 1);
+  if (worker_count == 1 || cell_count < MIN_PARALLEL_BATCH_SIZE) {
+    process_rows(0, n);
+    return matrix;
+  }
+
+  const size_t rows_per_chunk = (n + worker_count - 1) / worker_count;
+
+  std::vector<std::future<void>> chunk_futures;
+  chunk_futures.reserve(worker_count);
+  std::vector<std::function<void()>> chunk_tasks;
+  chunk_tasks.reserve(worker_count);
+
+  for (size_t row_begin = 0; row_begin < n; row_begin += rows_per_chunk) {
+    const size_t row_end = std::min(row_begin + rows_per_chunk, n);
+
+    auto promise = std::make_shared<std::promise<void>>();
+    chunk_futures.push_back(promise->get_future());
+
+    chunk_tasks.emplace_back([&process_rows, row_begin, row_end, promise]() {
+      process_rows(row_begin, row_end);
+      promise->set_value();
+    });
+  }
+
+  executor_->submit_batch(std::move(chunk_tasks));
+
+  for (auto &future : chunk_futures) {
+    future.wait();
+  }
+
+  return matrix;
+}
+
+std::unique_ptr<Core::ISimilaritySession>
+SimilarityEngine::create_session(Core::AlgorithmType algorithm,
+                                 const Core::AlgorithmConfig &config) {
+  auto global_config = config_manager_->get_global_config();
+  auto algorithm_config = config_manager_->get_algorithm_config(algorithm);
+  auto final_config = merge_configs(global_config, algorithm_config, algorithm);
+
+  final_config = merge_configs(final_config, config, algorithm);
+
+  auto algo = factory_->create_algorithm(algorithm, final_config);
+  return std::make_unique<SimilaritySession>(std::move(algo),
+                                             std::move(final_config));
+}
+
+std::unique_ptr<Core::IDocumentProfile>
+SimilarityEngine::create_profile(std::string_view text,
+                                 Core::AlgorithmType algorithm,
+                                 const Core::AlgorithmConfig &config) {
+  auto global_config = config_manager_->get_global_config();
+  auto algorithm_config = config_manager_->get_algorithm_config(algorithm);
+  auto final_config = merge_configs(global_config, algorithm_config, algorithm);
+
+  final_config = merge_configs(final_config, config, algorithm);
+
+  std::shared_ptr<Core::ISimilarityAlgorithm> algo =
+      factory_->create_algorithm(algorithm, final_config);
+  return std::make_unique<DocumentProfile>(
+      std::move(algo), std::move(final_config), std::string(text));
+}
+
+std::unique_ptr<Core::IIncrementalMatcher>
+SimilarityEngine::create_incremental_matcher(
+    std::vector<std::string> candidates, Core::AlgorithmType algorithm,
+    const Core::AlgorithmConfig &config) {
+  auto global_config = config_manager_->get_global_config();
+  auto algorithm_config = config_manager_->get_algorithm_config(algorithm);
+  auto final_config = merge_configs(global_config, algorithm_config, algorithm);
+
+  final_config = merge_configs(final_config, config, algorithm);
+
+  return std::make_unique<IncrementalMatcher>(std::move(candidates), algorithm,
+                                              std::move(final_config));
+}
+
+std::unique_ptr<Core::ICascade>
+SimilarityEngine::create_cascade(std::vector<Core::CascadeStage> stages) {
+  auto global_config = config_manager_->get_global_config();
+
+  for (auto &stage : stages) {
+    auto algorithm_config =
+        config_manager_->get_algorithm_config(stage.algorithm);
+    auto final_config =
+        merge_configs(global_config, algorithm_config, stage.algorithm);
+    stage.config = merge_configs(final_config, stage.config, stage.algorithm);
+  }
+
+  return std::make_unique<Cascade>(std::move(stages));
 }
 
 void SimilarityEngine::set_global_configuration(
     const Core::AlgorithmConfig &config) {
   config_manager_->set_global_config(config);
+
+  if (config.cache_capacity.has_value()) {
+    result_cache_.set_capacity(*config.cache_capacity);
+  }
+
   clear_caches(); // Clear cache as configuration changed
+
+  // (Re)attach the shared backend after the clear: a fresh attach must not
+  // wipe the segment other workers already warmed, while an explicit
+  // reconfigure of an attached engine invalidates it like any other cache
+  if (config.shared_cache.has_value()) {
+    if (*config.shared_cache) {
+      try {
+        shared_cache_ = std::make_unique<SharedResultCache>(
+            config.shared_cache_name.value_or(SharedResultCache::DEFAULT_NAME),
+            config.shared_cache_bytes.value_or(
+                SharedResultCache::DEFAULT_SIZE_BYTES));
+      } catch (const std::exception &) {
+        // Shared memory unavailable; keep using the in-process cache
+        shared_cache_.reset();
+      }
+    } else {
+      shared_cache_.reset();
+    }
+  }
 }
 
 Core::AlgorithmConfig SimilarityEngine::get_global_configuration() const {
@@ -381,13 +1354,56 @@ bool SimilarityEngine::supports_algorithm(
 }
 
 size_t SimilarityEngine::get_memory_usage() const noexcept {
-  std::lock_guard<std::mutex> lock(cache_mutex_);
-  return result_cache_.size() * (sizeof(CacheEntry) + 200); // Rough estimate
+  size_t usage =
+      result_cache_.memory_usage() + prepared_form_cache_.memory_usage();
+  if (shared_cache_) {
+    usage += shared_cache_->memory_usage();
+  }
+  return usage;
+}
+
+Core::CacheStatistics SimilarityEngine::get_cache_statistics() const noexcept {
+  if (shared_cache_) {
+    return shared_cache_->get_statistics();
+  }
+  return result_cache_.get_statistics();
+}
+
+Core::ExecutorStatistics
+SimilarityEngine::get_executor_statistics() const noexcept {
+  return executor_->get_statistics();
+}
+
+Core::PrefilterStatistics
+SimilarityEngine::get_prefilter_statistics() const noexcept {
+  Core::PrefilterStatistics stats;
+  stats.considered = prefilter_considered_.load(std::memory_order_relaxed);
+  stats.skipped = prefilter_skipped_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void SimilarityEngine::reset_statistics() noexcept {
+  total_operations_.store(0, std::memory_order_relaxed);
+  cache_hits_.store(0, std::memory_order_relaxed);
+  prefilter_considered_.store(0, std::memory_order_relaxed);
+  prefilter_skipped_.store(0, std::memory_order_relaxed);
+  result_cache_.reset_statistics();
+  prepared_form_cache_.reset_statistics();
+  if (shared_cache_) {
+    shared_cache_->reset_statistics();
+  }
+  if (executor_) {
+    executor_->reset_statistics();
+  }
+  Core::AlgorithmMetrics::reset();
 }
 
 void SimilarityEngine::clear_caches() noexcept {
-  std::lock_guard<std::mutex> lock(cache_mutex_);
   result_cache_.clear();
+  prepared_form_cache_.clear();
+  if (shared_cache_) {
+    shared_cache_->clear();
+  }
 }
 
 void SimilarityEngine::shutdown() noexcept {
@@ -400,32 +1416,15 @@ void SimilarityEngine::shutdown() noexcept {
 std::future<std::vector<Core::SimilarityResult>>
 SimilarityEngine::calculate_similarity_batch_parallel(
     std::vector<std::pair<std::string, std::string>> pairs,
-    Core::AlgorithmType algorithm, Core::AlgorithmConfig config) {
-  return std::async(std::launch::async, [this, pairs = std::move(pairs),
-                                         algorithm, config]() {
-    // Use a thread pool to parallelize the work
-    std::vector<std::future<Core::SimilarityResult>> futures;
-    futures.reserve(pairs.size());
-
-    for (const auto &pair : pairs) {
-      const auto &s1 = pair.first;
-      const auto &s2 = pair.second;
-      futures.emplace_back(
-          std::async(std::launch::async, [this, s1, s2, algorithm, config]() {
-            return calculate_similarity(s1, s2, algorithm, config);
-          }));
-    }
-
-    // Collect results
-    std::vector<Core::SimilarityResult> results;
-    results.reserve(futures.size());
-
-    for (auto &future : futures) {
-      results.push_back(future.get());
-    }
-
-    return results;
-  });
+    Core::AlgorithmType algorithm, Core::AlgorithmConfig config,
+    size_t concurrency) {
+  return std::async(std::launch::async,
+                    [this, pairs = std::move(pairs), algorithm,
+                     config = std::move(config), concurrency]() {
+                      // Chunked execution on the executor thread pool
+                      return calculate_similarity_batch(pairs, algorithm,
+                                                        config, concurrency);
+                    });
 }
 
 // Private helper methods
@@ -483,82 +1482,107 @@ SimilarityEngine::merge_configs(const Core::AlgorithmConfig &global,
   return merged;
 }
 
-std::string
-SimilarityEngine::create_cache_key(const std::string &s1, const std::string &s2,
+CacheKey
+SimilarityEngine::create_cache_key(std::string_view s1, std::string_view s2,
                                    Core::AlgorithmType algorithm,
                                    const Core::AlgorithmConfig &config) const {
-  std::ostringstream oss;
-  oss << static_cast<int>(algorithm) << "|"
-      << static_cast<int>(config.preprocessing) << "|"
-      << static_cast<int>(config.case_sensitivity) << "|" << config.ngram_size
-      << "|" << s1 << "|" << s2;
-  return oss.str();
-}
-
-std::optional<double>
-SimilarityEngine::get_cached_result(const std::string &key) const {
-  std::lock_guard<std::mutex> lock(cache_mutex_);
-
-  auto it = result_cache_.find(key);
-  if (it != result_cache_.end()) {
-    auto now = std::chrono::steady_clock::now();
-    if (now - it->second.timestamp < CACHE_TTL) {
-      return it->second.result;
-    } else {
-      // Expired entry
-      result_cache_.erase(it);
+  // Two hashes over the algorithm, the config fields that affect results,
+  // and both input strings, computed in one pass without the heap
+  // allocation of a concatenated key. The primary key is FNV-1a; the check
+  // hash is FNV-1 (multiply-then-xor), a genuinely different mixing order,
+  // so inputs colliding on one are caught by the other instead of the
+  // cache returning a different pair's score.
+  constexpr uint64_t FNV_OFFSET = 14695981039346656037ULL;
+  constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+  uint64_t hash = FNV_OFFSET;
+  uint64_t check = FNV_OFFSET;
+  auto mix_byte = [&hash, &check](uint8_t byte) {
+    hash ^= byte;
+    hash *= FNV_PRIME;
+    check *= FNV_PRIME;
+    check ^= byte;
+  };
+  auto mix_string = [&mix_byte](std::string_view s) {
+    for (char c : s) {
+      mix_byte(static_cast<uint8_t>(c));
     }
-  }
+    mix_byte(0xFF); // Separator so ("ab","c") and ("a","bc") differ
+  };
 
-  return std::nullopt;
-}
+  mix_byte(static_cast<uint8_t>(algorithm));
+  mix_byte(static_cast<uint8_t>(config.preprocessing));
+  mix_byte(static_cast<uint8_t>(config.case_sensitivity));
+  mix_byte(static_cast<uint8_t>(config.ngram_size));
+  mix_string(s1);
+  mix_string(s2);
+
+  // The lengths cost nothing to fold in and differ for most collisions
+  check ^= (static_cast<uint64_t>(s1.length()) << 32) ^ s2.length();
 
-void SimilarityEngine::cache_result(const std::string &key,
-                                    double result) const {
-  std::lock_guard<std::mutex> lock(cache_mutex_);
+  return {hash, check};
+}
 
-  // Simple LRU-like eviction
-  if (result_cache_.size() >= MAX_CACHE_SIZE) {
-    cleanup_cache();
+std::optional<double> SimilarityEngine::get_cached_result(CacheKey key) const {
+  if (shared_cache_) {
+    return shared_cache_->get(key.key);
   }
+  return result_cache_.get(key);
+}
 
-  result_cache_[key] =
-      CacheEntry{key, result, std::chrono::steady_clock::now()};
+void SimilarityEngine::cache_result(CacheKey key, double result) const {
+  if (shared_cache_) {
+    shared_cache_->put(key.key, result);
+    return;
+  }
+  result_cache_.put(key, result);
 }
 
-void SimilarityEngine::cleanup_cache() const {
-  auto now = std::chrono::steady_clock::now();
+std::shared_ptr<const PreparedForm>
+SimilarityEngine::get_prepared_form(std::string_view text,
+                                    Core::AlgorithmType algorithm,
+                                    const Core::AlgorithmConfig &config) const {
+  using StateKind = PreparedFormCache::StateKind;
+
+  StateKind kind = StateKind::None;
+  if (algorithm_uses_token_fingerprints(algorithm)) {
+    // Word-mode Jaccard compares distinct tokens, so its counter is clamped
+    // to set membership; the other token algorithms keep multiplicities
+    kind = (algorithm == Core::AlgorithmType::Jaccard &&
+            config.preprocessing == Core::PreprocessingMode::Word)
+               ? StateKind::TokenSet
+               : StateKind::TokenCounts;
+  }
 
-  // Remove expired entries
-  for (auto it = result_cache_.begin(); it != result_cache_.end();) {
-    if (now - it->second.timestamp >= CACHE_TTL) {
-      it = result_cache_.erase(it);
-    } else {
-      ++it;
-    }
+  const uint64_t key = PreparedFormCache::make_key(text, config, kind);
+  if (auto cached = prepared_form_cache_.get(key)) {
+    return cached;
   }
 
-  // If still too full, remove oldest entries
-  if (result_cache_.size() >= MAX_CACHE_SIZE) {
-    std::vector<std::pair<std::chrono::steady_clock::time_point, std::string>>
-        timestamps;
-    timestamps.reserve(result_cache_.size());
+  Core::UnicodeString raw{std::string(text)};
+  auto processed = Algorithms::BaseAlgorithm::preprocess_string(raw, config);
 
-    for (const auto &[key, entry] : result_cache_) {
-      timestamps.emplace_back(entry.timestamp, key);
-    }
+  std::shared_ptr<void> state;
+  if (kind != StateKind::None) {
+    auto tokens =
+        Algorithms::BaseAlgorithm::tokenize_string(processed, config);
+    state = std::make_shared<Algorithms::FlatCounter>(
+        Algorithms::FlatCounter::from_tokens(tokens,
+                                             kind == StateKind::TokenSet));
+  }
 
-    std::sort(timestamps.begin(), timestamps.end());
+  // Materialize the UTF-32 form before publishing: the lazy conversion is
+  // unsynchronized and the form is shared across worker threads
+  (void)processed.unicode();
 
-    size_t to_remove = result_cache_.size() - (MAX_CACHE_SIZE / 2);
-    for (size_t i = 0; i < to_remove && i < timestamps.size(); ++i) {
-      result_cache_.erase(timestamps[i].second);
-    }
-  }
+  auto form = std::make_shared<const PreparedForm>(std::move(processed),
+                                                   std::move(state));
+  prepared_form_cache_.put(key, form);
+  return form;
 }
 
-bool SimilarityEngine::validate_input(const std::string &s1,
-                                      const std::string &s2) const noexcept {
+bool SimilarityEngine::validate_input(std::string_view s1,
+                                      std::string_view s2) const noexcept {
   // Use configured max string length, defaulting to 100KB
   constexpr size_t DEFAULT_MAX_STRING_LENGTH = 100000; // 100KB limit
 
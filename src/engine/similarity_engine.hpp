@@ -2,14 +2,24 @@
 
 #include "../core/algorithm_factory.hpp"
 #include "../core/interfaces.hpp"
+#include "prepared_cache.hpp"
+#include "result_cache.hpp"
+#include "shared_result_cache.hpp"
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <future>
-#include <queue>
+#include <mutex>
 #include <thread>
 
 namespace TextSimilarity::Engine {
 
-// Async executor for non-blocking operations
+// Work-stealing async executor. Each worker owns a finely locked deque:
+// the owner pushes and pops at the front (so freshly submitted small tasks
+// stay hot on the submitting worker), idle workers steal from the back of
+// a victim's deque, and external threads distribute round-robin. This
+// replaces the single shared queue whose one mutex and wake-one condition
+// variable serialized every worker at high submission rates.
 class AsyncExecutor final : public Core::IAsyncExecutor {
 public:
   explicit AsyncExecutor(
@@ -30,22 +40,47 @@ public:
       std::unique_ptr<Core::ISimilarityAlgorithm> algorithm,
       Core::UnicodeString s1, Core::UnicodeString s2) override;
 
+  void submit(std::function<void()> task) override;
+  void submit_batch(std::vector<std::function<void()>> tasks) override;
+
+  [[nodiscard]] Core::ExecutorStatistics
+  get_statistics() const noexcept override;
+
+  void reset_statistics() noexcept override;
+
   void shutdown() noexcept override;
 
 private:
-  struct Task {
-    std::function<void()> work;
+  using Task = std::function<void()>;
 
-    Task(std::function<void()> w) : work(std::move(w)) {}
+  // One deque per worker; unique_ptr keeps the mutex/cv address-stable
+  struct WorkerQueue {
+    std::deque<Task> tasks;
+    std::mutex mutex;
+    std::condition_variable cv;
   };
 
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
   std::vector<std::thread> workers_;
-  std::queue<Task> task_queue_;
-  std::mutex queue_mutex_;
-  std::condition_variable cv_;
   std::atomic<bool> shutdown_{false};
-
-  void worker_loop();
+  std::atomic<size_t> next_queue_{0};
+  std::atomic<size_t> pending_{0};
+  std::atomic<size_t> executed_{0};
+  std::atomic<size_t> steals_{0};
+  std::atomic<uint64_t> task_wait_ns_{0};
+
+  // Identifies the owning worker for submission affinity
+  static thread_local const AsyncExecutor *current_executor_;
+  static thread_local size_t current_worker_;
+
+  void worker_loop(size_t index);
+  bool try_pop_own(size_t index, Task &task);
+  bool try_steal(size_t thief, Task &task);
+  void push_task(size_t index, Task task, bool to_front);
+
+  // Wraps a task so its time from enqueue to first instruction feeds the
+  // queue wait counter
+  [[nodiscard]] Task make_timed(Task task);
 };
 
 // Configuration manager implementation
@@ -73,6 +108,72 @@ private:
   [[nodiscard]] Core::AlgorithmConfig get_default_config() const noexcept;
 };
 
+// Session implementation holding a single long-lived algorithm instance.
+// The factory allocation and configuration merge are performed once by
+// SimilarityEngine::create_session instead of on every call.
+class SimilaritySession final : public Core::ISimilaritySession {
+public:
+  SimilaritySession(std::unique_ptr<Core::ISimilarityAlgorithm> algorithm,
+                    Core::AlgorithmConfig config);
+  ~SimilaritySession() override = default;
+
+  // Non-copyable, non-movable
+  SimilaritySession(const SimilaritySession &) = delete;
+  SimilaritySession &operator=(const SimilaritySession &) = delete;
+  SimilaritySession(SimilaritySession &&) = delete;
+  SimilaritySession &operator=(SimilaritySession &&) = delete;
+
+  [[nodiscard]] Core::SimilarityResult
+  calculate_similarity(const std::string &s1, const std::string &s2) override;
+
+  [[nodiscard]] Core::DistanceResult
+  calculate_distance(const std::string &s1, const std::string &s2) override;
+
+  [[nodiscard]] Core::AlgorithmType get_algorithm_type() const noexcept override;
+  [[nodiscard]] Core::AlgorithmConfig get_configuration() const override;
+
+private:
+  std::unique_ptr<Core::ISimilarityAlgorithm> algorithm_;
+  Core::AlgorithmConfig config_;
+  size_t max_string_length_;
+
+  [[nodiscard]] bool validate_input(const std::string &s1,
+                                    const std::string &s2) const noexcept;
+};
+
+// Profile implementation: one algorithm instance plus the prepared form
+// of one document. Creation pays for normalization, tokenization and
+// frequency-vector construction once; similarity_to reuses the prepared
+// state on both sides.
+class DocumentProfile final : public Core::IDocumentProfile {
+public:
+  DocumentProfile(std::shared_ptr<Core::ISimilarityAlgorithm> algorithm,
+                  Core::AlgorithmConfig config, const std::string &text);
+  ~DocumentProfile() override = default;
+
+  // Non-copyable, non-movable
+  DocumentProfile(const DocumentProfile &) = delete;
+  DocumentProfile &operator=(const DocumentProfile &) = delete;
+  DocumentProfile(DocumentProfile &&) = delete;
+  DocumentProfile &operator=(DocumentProfile &&) = delete;
+
+  [[nodiscard]] Core::SimilarityResult
+  similarity_to(const Core::IDocumentProfile &other) const override;
+
+  [[nodiscard]] Core::SimilarityResult
+  similarity_to_text(const std::string &text) const override;
+
+  [[nodiscard]] Core::AlgorithmType get_algorithm_type() const noexcept override;
+  [[nodiscard]] Core::AlgorithmConfig get_configuration() const override;
+
+private:
+  // Shared so two profiles of the same algorithm type can be compared even
+  // though each carries its own instance
+  std::shared_ptr<Core::ISimilarityAlgorithm> algorithm_;
+  Core::AlgorithmConfig config_;
+  std::unique_ptr<Core::IPreparedQuery> prepared_;
+};
+
 // Main similarity engine implementation
 class SimilarityEngine final : public Core::ISimilarityEngine {
 public:
@@ -91,12 +192,12 @@ public:
 
   // Synchronous operations
   [[nodiscard]] Core::SimilarityResult calculate_similarity(
-      const std::string &s1, const std::string &s2,
+      std::string_view s1, std::string_view s2,
       Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein,
       const Core::AlgorithmConfig &config = {}) override;
 
   [[nodiscard]] Core::DistanceResult calculate_distance(
-      const std::string &s1, const std::string &s2,
+      std::string_view s1, std::string_view s2,
       Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein,
       const Core::AlgorithmConfig &config = {}) override;
 
@@ -111,10 +212,75 @@ public:
       Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein,
       Core::AlgorithmConfig config = {}) override;
 
-  // Batch operations
+  // Batch operations (fans out across the executor thread pool)
   [[nodiscard]] std::vector<Core::SimilarityResult> calculate_similarity_batch(
       const std::vector<std::pair<std::string, std::string>> &pairs,
       Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein,
+      const Core::AlgorithmConfig &config = {},
+      size_t concurrency = 0) override;
+
+  // One-to-many operations (query-side preprocessing is done once)
+  [[nodiscard]] std::vector<Core::SimilarityResult> calculate_one_to_many(
+      std::string_view query, const std::vector<std::string_view> &candidates,
+      Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein,
+      const Core::AlgorithmConfig &config = {}) override;
+
+  // Top-K query (bounded min-heap; the heap cutoff drives the banded DP
+  // threshold for early-termination-capable algorithms)
+  [[nodiscard]] std::vector<Core::TopKMatch>
+  find_top_k(const std::string &query,
+             const std::vector<std::string> &candidates, size_t k,
+             double min_similarity = 0.0,
+             Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein,
+             const Core::AlgorithmConfig &config = {}) override;
+
+  // All-pairs similarity matrix (each string is converted once; rows are
+  // fanned out across the executor thread pool in contiguous blocks)
+  [[nodiscard]] std::vector<double>
+  similarity_matrix(const std::vector<std::string> &strings,
+                    Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein,
+                    const Core::AlgorithmConfig &config = {},
+                    size_t concurrency = 0) override;
+
+  // Session management (configuration merge and algorithm creation happen
+  // once per session instead of once per call)
+  [[nodiscard]] std::unique_ptr<Core::ISimilaritySession>
+  create_session(Core::AlgorithmType algorithm,
+                 const Core::AlgorithmConfig &config = {}) override;
+
+  // Profile management (the text is normalized and tokenized once here;
+  // every later comparison against the profile skips that work)
+  [[nodiscard]] std::unique_ptr<Core::IDocumentProfile>
+  create_profile(std::string_view text,
+                 Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein,
+                 const Core::AlgorithmConfig &config = {}) override;
+
+  // Incremental matching (per-candidate DP rows persist across update
+  // calls, so append-only query changes cost only the appended rows)
+  [[nodiscard]] std::unique_ptr<Core::IIncrementalMatcher>
+  create_incremental_matcher(
+      std::vector<std::string> candidates,
+      Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein,
+      const Core::AlgorithmConfig &config = {}) override;
+
+  // Cascade scoring (each stage's config is merged and its algorithm
+  // created once here; evaluation short-circuits at the first stage whose
+  // score misses its cutoff)
+  [[nodiscard]] std::unique_ptr<Core::ICascade>
+  create_cascade(std::vector<Core::CascadeStage> stages) override;
+
+  // Indexed queries (documents come preprocessed and pre-tokenized from a
+  // memory-mapped corpus index)
+  [[nodiscard]] std::vector<Core::SimilarityResult>
+  calculate_one_to_many_indexed(
+      std::string_view query, const Index::CorpusIndex &index,
+      Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein,
+      const Core::AlgorithmConfig &config = {}) override;
+
+  [[nodiscard]] std::vector<Core::TopKMatch> find_top_k_indexed(
+      std::string_view query, const Index::CorpusIndex &index, size_t k,
+      double min_similarity = 0.0,
+      Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein,
       const Core::AlgorithmConfig &config = {}) override;
 
   // Configuration management
@@ -129,6 +295,13 @@ public:
 
   // Performance and diagnostics
   [[nodiscard]] size_t get_memory_usage() const noexcept override;
+  [[nodiscard]] Core::CacheStatistics
+  get_cache_statistics() const noexcept override;
+  [[nodiscard]] Core::PrefilterStatistics
+  get_prefilter_statistics() const noexcept override;
+  [[nodiscard]] Core::ExecutorStatistics
+  get_executor_statistics() const noexcept override;
+  void reset_statistics() noexcept override;
   void clear_caches() noexcept override;
   void shutdown() noexcept override;
 
@@ -145,7 +318,7 @@ public:
   calculate_similarity_batch_parallel(
       std::vector<std::pair<std::string, std::string>> pairs,
       Core::AlgorithmType algorithm = Core::AlgorithmType::Levenshtein,
-      Core::AlgorithmConfig config = {});
+      Core::AlgorithmConfig config = {}, size_t concurrency = 0);
 
 private:
   std::unique_ptr<Core::IAlgorithmFactory> factory_;
@@ -155,18 +328,23 @@ private:
   // Performance metrics
   mutable std::atomic<size_t> total_operations_{0};
   mutable std::atomic<size_t> cache_hits_{0};
+  mutable std::atomic<size_t> prefilter_considered_{0};
+  mutable std::atomic<size_t> prefilter_skipped_{0};
 
-  // Result caching (simple LRU-like cache)
-  struct CacheEntry {
-    std::string key;
-    double result;
-    std::chrono::steady_clock::time_point timestamp;
-  };
+  // Result caching (sharded, CLOCK-evicted; see result_cache.hpp)
+  mutable ResultCache result_cache_;
+
+  // Optional cross-process cache replacing result_cache_ when the global
+  // configuration enables it (see shared_result_cache.hpp); null when
+  // disabled or when attaching to shared memory failed
+  mutable std::unique_ptr<SharedResultCache> shared_cache_;
+
+  // Per-string prepared forms shared across pairs and across algorithms
+  // with the same preprocessing (see prepared_cache.hpp)
+  mutable PreparedFormCache prepared_form_cache_;
 
-  mutable std::mutex cache_mutex_;
-  mutable std::unordered_map<std::string, CacheEntry> result_cache_;
-  static constexpr size_t MAX_CACHE_SIZE = 10000;
-  static constexpr std::chrono::minutes CACHE_TTL{5};
+  // Batches smaller than this are not worth the fan-out overhead
+  static constexpr size_t MIN_PARALLEL_BATCH_SIZE = 32;
 
   // Helper methods
   [[nodiscard]] Core::AlgorithmConfig
@@ -174,19 +352,24 @@ private:
                 const Core::AlgorithmConfig &local,
                 Core::AlgorithmType algorithm) const;
 
-  [[nodiscard]] std::string
-  create_cache_key(const std::string &s1, const std::string &s2,
+  [[nodiscard]] CacheKey
+  create_cache_key(std::string_view s1, std::string_view s2,
                    Core::AlgorithmType algorithm,
                    const Core::AlgorithmConfig &config) const;
 
-  [[nodiscard]] std::optional<double>
-  get_cached_result(const std::string &key) const;
-  void cache_result(const std::string &key, double result) const;
-  void cleanup_cache() const;
+  [[nodiscard]] std::optional<double> get_cached_result(CacheKey key) const;
+  void cache_result(CacheKey key, double result) const;
+
+  // Fetches or builds the prepared form of one input string: validated
+  // Unicode, case folding applied, and for token algorithms the coalesced
+  // token counter. Throws on invalid UTF-8 like the UnicodeString ctor.
+  [[nodiscard]] std::shared_ptr<const PreparedForm>
+  get_prepared_form(std::string_view text, Core::AlgorithmType algorithm,
+                    const Core::AlgorithmConfig &config) const;
 
   // Validation helpers
-  [[nodiscard]] bool validate_input(const std::string &s1,
-                                    const std::string &s2) const noexcept;
+  [[nodiscard]] bool validate_input(std::string_view s1,
+                                    std::string_view s2) const noexcept;
   [[nodiscard]] Core::SimilarityResult
   create_validation_error(const std::string &message) const;
 };
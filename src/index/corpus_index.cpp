@@ -0,0 +1,255 @@
+#include "corpus_index.hpp"
+#include "../algorithms/token_based.hpp"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <cstdio>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace TextSimilarity::Index {
+
+namespace {
+
+constexpr char INDEX_MAGIC[4] = {'T', 'S', 'I', 'X'};
+
+// Sections holding 8-byte values must start 8-byte aligned in the mapping
+constexpr uint64_t align8(uint64_t value) noexcept {
+  return (value + 7) & ~static_cast<uint64_t>(7);
+}
+
+} // namespace
+
+void CorpusIndex::build(const std::vector<std::string> &strings,
+                        const Core::AlgorithmConfig &config,
+                        const std::string &path) {
+  const size_t document_count = strings.size();
+
+  std::vector<uint64_t> text_offsets;
+  std::vector<uint64_t> entry_offsets;
+  std::string text_data;
+  std::vector<uint64_t> entry_hashes;
+  std::vector<uint32_t> entry_counts;
+
+  text_offsets.reserve(document_count + 1);
+  entry_offsets.reserve(document_count + 1);
+  text_offsets.push_back(0);
+  entry_offsets.push_back(0);
+
+  // Preprocess and tokenize each document exactly once, exactly as the
+  // algorithms would at query time
+  for (const auto &str : strings) {
+    Core::UnicodeString original{str};
+    auto processed =
+        Algorithms::BaseAlgorithm::preprocess_string(original, config);
+    auto tokens = Algorithms::BaseAlgorithm::tokenize_string(processed, config);
+    auto counter = Algorithms::FlatCounter::from_tokens(tokens);
+
+    text_data.append(processed.utf8());
+    text_offsets.push_back(text_data.size());
+
+    for (const auto &entry : counter.entries()) {
+      entry_hashes.push_back(entry.hash);
+      entry_counts.push_back(entry.count);
+    }
+    entry_offsets.push_back(entry_hashes.size());
+  }
+
+  IndexHeader header{};
+  std::memcpy(header.magic, INDEX_MAGIC, sizeof(header.magic));
+  header.version = FORMAT_VERSION;
+  header.preprocessing = static_cast<uint32_t>(config.preprocessing);
+  header.case_sensitivity = static_cast<uint32_t>(config.case_sensitivity);
+  header.ngram_size = config.ngram_size;
+  header.document_count = document_count;
+
+  header.text_offsets_pos = sizeof(IndexHeader);
+  header.text_data_pos =
+      header.text_offsets_pos + text_offsets.size() * sizeof(uint64_t);
+  header.entry_offsets_pos = align8(header.text_data_pos + text_data.size());
+  header.entry_hashes_pos =
+      header.entry_offsets_pos + entry_offsets.size() * sizeof(uint64_t);
+  header.entry_counts_pos =
+      header.entry_hashes_pos + entry_hashes.size() * sizeof(uint64_t);
+  header.file_size =
+      header.entry_counts_pos + entry_counts.size() * sizeof(uint32_t);
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    throw std::runtime_error("Cannot open index file for writing: " + path);
+  }
+
+  auto write_bytes = [&out](const void *data, size_t bytes) {
+    out.write(static_cast<const char *>(data),
+              static_cast<std::streamsize>(bytes));
+  };
+
+  write_bytes(&header, sizeof(header));
+  write_bytes(text_offsets.data(), text_offsets.size() * sizeof(uint64_t));
+  write_bytes(text_data.data(), text_data.size());
+
+  // Pad so the entry offsets start 8-byte aligned
+  uint64_t padding =
+      header.entry_offsets_pos - (header.text_data_pos + text_data.size());
+  const char zeros[8] = {};
+  write_bytes(zeros, padding);
+
+  write_bytes(entry_offsets.data(), entry_offsets.size() * sizeof(uint64_t));
+  write_bytes(entry_hashes.data(), entry_hashes.size() * sizeof(uint64_t));
+  write_bytes(entry_counts.data(), entry_counts.size() * sizeof(uint32_t));
+
+  if (!out) {
+    throw std::runtime_error("Failed to write index file: " + path);
+  }
+}
+
+std::shared_ptr<CorpusIndex> CorpusIndex::load(const std::string &path) {
+  // std::make_shared needs a public constructor; the factory owns creation
+  std::shared_ptr<CorpusIndex> index(new CorpusIndex());
+  index->map_file(path);
+  index->validate();
+  return index;
+}
+
+void CorpusIndex::map_file(const std::string &path) {
+#ifdef _WIN32
+  // No mmap on this platform; fall back to reading the file into memory.
+  // Startup still skips preprocessing and tokenization.
+  std::FILE *file = std::fopen(path.c_str(), "rb");
+  if (!file) {
+    throw std::runtime_error("Cannot open index file: " + path);
+  }
+  std::fseek(file, 0, SEEK_END);
+  long size = std::ftell(file);
+  std::fseek(file, 0, SEEK_SET);
+  if (size < 0) {
+    std::fclose(file);
+    throw std::runtime_error("Cannot determine index file size: " + path);
+  }
+  mapping_size_ = static_cast<size_t>(size);
+  mapping_ = new char[mapping_size_];
+  size_t read = std::fread(mapping_, 1, mapping_size_, file);
+  std::fclose(file);
+  if (read != mapping_size_) {
+    throw std::runtime_error("Failed to read index file: " + path);
+  }
+#else
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Cannot open index file: " + path);
+  }
+
+  struct stat file_stat {};
+  if (::fstat(fd, &file_stat) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Cannot stat index file: " + path);
+  }
+  mapping_size_ = static_cast<size_t>(file_stat.st_size);
+
+  void *mapping =
+      ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // the mapping keeps the file alive
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error("Cannot memory-map index file: " + path);
+  }
+  mapping_ = mapping;
+#endif
+}
+
+void CorpusIndex::validate() {
+  const char *base = static_cast<const char *>(mapping_);
+
+  if (mapping_size_ < sizeof(IndexHeader)) {
+    throw std::runtime_error("Index file is too small to hold a header");
+  }
+
+  const auto *header = reinterpret_cast<const IndexHeader *>(base);
+  if (std::memcmp(header->magic, INDEX_MAGIC, sizeof(header->magic)) != 0) {
+    throw std::runtime_error("Index file has an unknown format (bad magic)");
+  }
+  if (header->version != FORMAT_VERSION) {
+    throw std::runtime_error("Index file format version is not supported");
+  }
+  if (header->file_size != mapping_size_) {
+    throw std::runtime_error("Index file is truncated or has trailing data");
+  }
+
+  const uint64_t n = header->document_count;
+  const uint64_t offsets_bytes = (n + 1) * sizeof(uint64_t);
+  if (header->text_offsets_pos + offsets_bytes > mapping_size_ ||
+      header->entry_offsets_pos + offsets_bytes > mapping_size_ ||
+      header->text_data_pos > mapping_size_ ||
+      header->entry_hashes_pos > mapping_size_ ||
+      header->entry_counts_pos > mapping_size_) {
+    throw std::runtime_error("Index file sections exceed the file size");
+  }
+
+  header_ = header;
+  text_offsets_ =
+      reinterpret_cast<const uint64_t *>(base + header->text_offsets_pos);
+  text_data_ = base + header->text_data_pos;
+  entry_offsets_ =
+      reinterpret_cast<const uint64_t *>(base + header->entry_offsets_pos);
+  entry_hashes_ =
+      reinterpret_cast<const uint64_t *>(base + header->entry_hashes_pos);
+  entry_counts_ =
+      reinterpret_cast<const uint32_t *>(base + header->entry_counts_pos);
+
+  // The per-document runs must stay inside their sections
+  const uint64_t text_bytes = text_offsets_[n];
+  const uint64_t entry_count = entry_offsets_[n];
+  if (header->text_data_pos + text_bytes > mapping_size_ ||
+      header->entry_hashes_pos + entry_count * sizeof(uint64_t) >
+          mapping_size_ ||
+      header->entry_counts_pos + entry_count * sizeof(uint32_t) >
+          mapping_size_) {
+    throw std::runtime_error("Index file document data exceeds the file size");
+  }
+}
+
+CorpusIndex::~CorpusIndex() {
+  if (mapping_) {
+#ifdef _WIN32
+    delete[] static_cast<char *>(mapping_);
+#else
+    ::munmap(mapping_, mapping_size_);
+#endif
+  }
+}
+
+std::string_view CorpusIndex::text(size_t index) const noexcept {
+  const uint64_t begin = text_offsets_[index];
+  const uint64_t end = text_offsets_[index + 1];
+  return std::string_view(text_data_ + begin, end - begin);
+}
+
+const uint64_t *CorpusIndex::token_hashes(size_t index) const noexcept {
+  return entry_hashes_ + entry_offsets_[index];
+}
+
+const uint32_t *CorpusIndex::token_counts(size_t index) const noexcept {
+  return entry_counts_ + entry_offsets_[index];
+}
+
+size_t CorpusIndex::token_entry_count(size_t index) const noexcept {
+  return static_cast<size_t>(entry_offsets_[index + 1] -
+                             entry_offsets_[index]);
+}
+
+Core::AlgorithmConfig CorpusIndex::preprocessing_config() const noexcept {
+  Core::AlgorithmConfig config{};
+  config.preprocessing =
+      static_cast<Core::PreprocessingMode>(header_->preprocessing);
+  config.case_sensitivity =
+      static_cast<Core::CaseSensitivity>(header_->case_sensitivity);
+  config.ngram_size = header_->ngram_size;
+  return config;
+}
+
+} // namespace TextSimilarity::Index
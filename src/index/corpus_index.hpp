@@ -0,0 +1,100 @@
+#pragma once
+
+#include "../core/types.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace TextSimilarity::Index {
+
+// On-disk index header. The format is native-endian and version-checked;
+// cross-endian portability is intentionally out of scope.
+struct IndexHeader {
+  char magic[4];         // "TSIX"
+  uint32_t version;      // FORMAT_VERSION
+  uint32_t preprocessing;    // Core::PreprocessingMode the index was built with
+  uint32_t case_sensitivity; // Core::CaseSensitivity the index was built with
+  uint32_t ngram_size;
+  uint32_t reserved;
+  uint64_t document_count;
+  uint64_t text_offsets_pos;  // document_count + 1 uint64 byte offsets
+  uint64_t text_data_pos;     // concatenated preprocessed UTF-8
+  uint64_t entry_offsets_pos; // document_count + 1 uint64 entry offsets
+  uint64_t entry_hashes_pos;  // uint64 fingerprints, sorted per document
+  uint64_t entry_counts_pos;  // uint32 token counts, parallel to hashes
+  uint64_t file_size;         // total size, for truncation detection
+};
+
+// Persistent, memory-mapped corpus index.
+//
+// build() preprocesses and tokenizes every string once and lays the results
+// out contiguously:
+//
+//   IndexHeader
+//   uint64 text_offsets[n + 1]     preprocessed UTF-8, one slice per document
+//   char   text_data[...]
+//   uint64 entry_offsets[n + 1]    token fingerprint runs per document
+//   uint64 entry_hashes[...]       sorted by fingerprint within a document
+//   uint32 entry_counts[...]
+//
+// load() maps the file and validates the header, so a process restart costs
+// an mmap plus a header check instead of a full corpus rebuild. Token
+// algorithms score documents straight from the mapped fingerprints; other
+// algorithms use the stored preprocessed text.
+class CorpusIndex final {
+public:
+  static constexpr uint32_t FORMAT_VERSION = 1;
+
+  // Preprocesses, tokenizes and writes the index for one preprocessing
+  // configuration. Throws std::runtime_error on I/O failure.
+  static void build(const std::vector<std::string> &strings,
+                    const Core::AlgorithmConfig &config,
+                    const std::string &path);
+
+  // Opens an index via memory mapping. Throws std::runtime_error when the
+  // file is missing, truncated or written by an unknown format version.
+  [[nodiscard]] static std::shared_ptr<CorpusIndex> load(const std::string &path);
+
+  ~CorpusIndex();
+
+  // Non-copyable, non-movable (owns the mapping)
+  CorpusIndex(const CorpusIndex &) = delete;
+  CorpusIndex &operator=(const CorpusIndex &) = delete;
+  CorpusIndex(CorpusIndex &&) = delete;
+  CorpusIndex &operator=(CorpusIndex &&) = delete;
+
+  [[nodiscard]] size_t size() const noexcept {
+    return static_cast<size_t>(header_->document_count);
+  }
+
+  // Preprocessed UTF-8 of one document, viewing the mapped file
+  [[nodiscard]] std::string_view text(size_t index) const noexcept;
+
+  // Token fingerprint run of one document (sorted by hash)
+  [[nodiscard]] const uint64_t *token_hashes(size_t index) const noexcept;
+  [[nodiscard]] const uint32_t *token_counts(size_t index) const noexcept;
+  [[nodiscard]] size_t token_entry_count(size_t index) const noexcept;
+
+  // Preprocessing snapshot the index was built with; queries against the
+  // index must tokenize with these settings to stay comparable
+  [[nodiscard]] Core::AlgorithmConfig preprocessing_config() const noexcept;
+
+private:
+  CorpusIndex() = default;
+
+  void map_file(const std::string &path);
+  void validate();
+
+  void *mapping_{nullptr};
+  size_t mapping_size_{0};
+  const IndexHeader *header_{nullptr};
+  const uint64_t *text_offsets_{nullptr};
+  const char *text_data_{nullptr};
+  const uint64_t *entry_offsets_{nullptr};
+  const uint64_t *entry_hashes_{nullptr};
+  const uint32_t *entry_counts_{nullptr};
+};
+
+} // namespace TextSimilarity::Index
@@ -0,0 +1,142 @@
+#include "inverted_index.hpp"
+#include "../algorithms/base_algorithm.hpp"
+#include "../core/algorithm_factory.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace TextSimilarity::Index {
+
+NGramInvertedIndex::NGramInvertedIndex(const std::vector<std::string> &strings,
+                                       const Core::AlgorithmConfig &config)
+    : config_(config), factory_(Core::create_algorithm_factory()) {
+  documents_.reserve(strings.size());
+  texts_.reserve(strings.size());
+
+  for (size_t i = 0; i < strings.size(); ++i) {
+    Core::UnicodeString original{strings[i]};
+    auto processed =
+        Algorithms::BaseAlgorithm::preprocess_string(original, config_);
+    auto tokens =
+        Algorithms::BaseAlgorithm::tokenize_string(processed, config_);
+    auto counter = Algorithms::FlatCounter::from_tokens(tokens);
+
+    for (const auto &entry : counter.entries()) {
+      postings_[entry.hash].push_back(
+          Posting{static_cast<uint32_t>(i), entry.count});
+    }
+
+    documents_.push_back(std::move(counter));
+    texts_.push_back(std::move(processed));
+  }
+}
+
+std::vector<Core::TopKMatch>
+NGramInvertedIndex::query(std::string_view text, double min_similarity,
+                          Core::AlgorithmType algorithm) const {
+  if (algorithm != Core::AlgorithmType::Jaccard &&
+      algorithm != Core::AlgorithmType::SorensenDice) {
+    throw std::invalid_argument(
+        "Inverted index queries support Jaccard and SorensenDice only");
+  }
+
+  min_similarity = std::clamp(min_similarity, 0.0, 1.0);
+
+  // Word-mode Jaccard compares distinct tokens; the stored multiset counts
+  // are clamped to set membership on the fly
+  const bool as_set = algorithm == Core::AlgorithmType::Jaccard &&
+                      config_.preprocessing == Core::PreprocessingMode::Word;
+
+  Core::UnicodeString query_string{std::string(text)};
+  auto processed =
+      Algorithms::BaseAlgorithm::preprocess_string(query_string, config_);
+  auto tokens = Algorithms::BaseAlgorithm::tokenize_string(processed, config_);
+  auto query_counter = Algorithms::FlatCounter::from_tokens(tokens, as_set);
+
+  if (query_counter.empty()) {
+    return {};
+  }
+
+  // Walk only the posting lists of the query's own tokens, accumulating the
+  // exact multiset intersection size per touched candidate
+  std::unordered_map<uint32_t, uint32_t> shared;
+  for (const auto &entry : query_counter.entries()) {
+    auto it = postings_.find(entry.hash);
+    if (it == postings_.end()) {
+      continue;
+    }
+    for (const auto &posting : it->second) {
+      const uint32_t doc_count = as_set ? 1 : posting.count;
+      shared[posting.document] += std::min(entry.count, doc_count);
+    }
+  }
+
+  // Count filter: from similarity >= t it follows that the intersection
+  // size I must satisfy
+  //   Jaccard  I / (Sa + Sb - I) >= t  =>  I >= t / (1 + t) * (Sa + Sb)
+  //   Dice     2I / (Sa + Sb)    >= t  =>  I >= t / 2 * (Sa + Sb)
+  // Candidates below the bound cannot reach the threshold and are dropped
+  // before exact scoring
+  const double factor = (algorithm == Core::AlgorithmType::Jaccard)
+                            ? min_similarity / (1.0 + min_similarity)
+                            : min_similarity / 2.0;
+  const auto query_total =
+      static_cast<double>(query_counter.total_count());
+
+  auto algo = factory_->create_algorithm(algorithm, config_);
+  auto prepared = algo->prepare_query(query_string);
+
+  std::vector<Core::TopKMatch> matches;
+  for (const auto &[document, intersection] : shared) {
+    const auto &counter = documents_[document];
+    const double document_total =
+        as_set ? static_cast<double>(counter.size())
+               : static_cast<double>(counter.total_count());
+
+    const double required = factor * (query_total + document_total);
+    if (static_cast<double>(intersection) + 1e-9 < required) {
+      continue;
+    }
+
+    // Exact verification through the algorithm itself, reusing the stored
+    // counter as prepared state
+    std::shared_ptr<Algorithms::FlatCounter> state;
+    if (as_set) {
+      std::vector<uint64_t> hashes;
+      std::vector<uint32_t> counts;
+      hashes.reserve(counter.size());
+      counts.reserve(counter.size());
+      for (const auto &entry : counter.entries()) {
+        hashes.push_back(entry.hash);
+        counts.push_back(entry.count);
+      }
+      state = std::make_shared<Algorithms::FlatCounter>(
+          Algorithms::FlatCounter::from_sorted_entries(
+              hashes.data(), counts.data(), hashes.size(), true));
+    } else {
+      state = std::make_shared<Algorithms::FlatCounter>(counter);
+    }
+
+    auto document_prepared =
+        algo->adopt_prepared_state(texts_[document], std::move(state));
+    auto result =
+        algo->calculate_similarity_profiles(*prepared, *document_prepared);
+    if (!result.is_success() || result.value() < min_similarity) {
+      continue;
+    }
+
+    matches.push_back(Core::TopKMatch{document, result.value()});
+  }
+
+  // Best first; ties break toward the earlier document for determinism
+  std::sort(matches.begin(), matches.end(),
+            [](const Core::TopKMatch &a, const Core::TopKMatch &b) {
+              if (a.similarity != b.similarity) {
+                return a.similarity > b.similarity;
+              }
+              return a.index < b.index;
+            });
+
+  return matches;
+}
+
+} // namespace TextSimilarity::Index
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "../algorithms/token_based.hpp"
+#include "../core/interfaces.hpp"
+#include "../core/types.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace TextSimilarity::Index {
+
+// In-memory inverted index over token fingerprints for sub-linear fuzzy
+// lookup.
+//
+// Construction tokenizes every document once and maps each distinct
+// fingerprint to a posting list of (document, count) pairs. A query walks
+// only the posting lists of its own tokens, accumulating the exact multiset
+// intersection size per candidate, and applies count filtering: a candidate
+// that shares fewer tokens with the query than the similarity threshold
+// requires is discarded before any exact scoring happens. Survivors are
+// scored by the real algorithm through the prepared-query path, so results
+// match brute-force scoring exactly.
+//
+// Documents sharing no tokens with the query have similarity zero and are
+// never returned, regardless of the threshold.
+class NGramInvertedIndex final {
+public:
+  // Tokenizes and indexes the documents under one preprocessing
+  // configuration (typically NGram mode; any tokenizing mode works)
+  NGramInvertedIndex(const std::vector<std::string> &strings,
+                     const Core::AlgorithmConfig &config);
+
+  [[nodiscard]] size_t size() const noexcept { return documents_.size(); }
+
+  // Retrieve and score every document that can reach min_similarity.
+  // Supported algorithms are Jaccard and SorensenDice (the count filter is
+  // derived from their threshold algebra); results are best first.
+  [[nodiscard]] std::vector<Core::TopKMatch>
+  query(std::string_view text, double min_similarity,
+        Core::AlgorithmType algorithm = Core::AlgorithmType::Jaccard) const;
+
+private:
+  struct Posting {
+    uint32_t document;
+    uint32_t count;
+  };
+
+  Core::AlgorithmConfig config_;
+  std::unique_ptr<Core::IAlgorithmFactory> factory_;
+  std::unordered_map<uint64_t, std::vector<Posting>> postings_;
+  std::vector<Algorithms::FlatCounter> documents_;
+  std::vector<Core::UnicodeString> texts_; // preprocessed, for exact scoring
+};
+
+} // namespace TextSimilarity::Index
@@ -0,0 +1,267 @@
+#include "minhash_index.hpp"
+#include "../algorithms/base_algorithm.hpp"
+#include "../core/algorithm_factory.hpp"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace TextSimilarity::LSH {
+
+namespace {
+constexpr uint32_t DEFAULT_PERMUTATIONS = 128;
+constexpr uint32_t DEFAULT_BANDS = 32;
+
+// Fixed seed so signatures are reproducible across processes; anything
+// built with the same configuration can be compared
+constexpr uint64_t PERMUTATION_SEED = 0x5151C0DE2026ULL;
+
+// FNV-1a over one band of signature rows; the per-band bucket tables keep
+// bands separate so the band index needs no mixing
+uint64_t band_bucket(const uint32_t *rows, uint32_t count) noexcept {
+  uint64_t hash = 14695981039346656037ULL;
+  for (uint32_t i = 0; i < count; ++i) {
+    uint32_t value = rows[i];
+    for (int byte = 0; byte < 4; ++byte) {
+      hash ^= (value >> (byte * 8)) & 0xFFU;
+      hash *= 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
+// Disjoint-set with path halving for duplicate clustering
+uint32_t find_root(std::vector<uint32_t> &parent, uint32_t node) {
+  while (parent[node] != node) {
+    parent[node] = parent[parent[node]];
+    node = parent[node];
+  }
+  return node;
+}
+} // namespace
+
+MinHashIndex::MinHashIndex(const std::vector<std::string> &strings,
+                           const Core::AlgorithmConfig &config)
+    : config_(config), factory_(Core::create_algorithm_factory()),
+      permutations_(config.minhash_permutations.value_or(DEFAULT_PERMUTATIONS)),
+      bands_(config.lsh_bands.value_or(DEFAULT_BANDS)) {
+  if (permutations_ == 0 || bands_ == 0 || permutations_ % bands_ != 0) {
+    throw std::invalid_argument(
+        "LSH band count must be positive and divide the permutation count");
+  }
+  rows_per_band_ = permutations_ / bands_;
+
+  // Multiply-shift permutations: odd multipliers make the map a bijection
+  // on 64-bit values, the top 32 bits of a*x+b serve as the hash
+  std::mt19937_64 rng(PERMUTATION_SEED);
+  permutation_params_.reserve(permutations_);
+  for (uint32_t i = 0; i < permutations_; ++i) {
+    permutation_params_.push_back(Permutation{rng() | 1ULL, rng()});
+  }
+
+  documents_.reserve(strings.size());
+  texts_.reserve(strings.size());
+  signatures_.resize(strings.size() * static_cast<size_t>(permutations_));
+  buckets_.resize(bands_);
+
+  // Word-mode Jaccard compares distinct tokens; matching the exact scorer
+  // here keeps verification consistent (MinHash itself is always set-based)
+  const bool as_set = config_.preprocessing == Core::PreprocessingMode::Word;
+
+  for (size_t i = 0; i < strings.size(); ++i) {
+    Core::UnicodeString original{strings[i]};
+    auto processed =
+        Algorithms::BaseAlgorithm::preprocess_string(original, config_);
+    auto tokens =
+        Algorithms::BaseAlgorithm::tokenize_string(processed, config_);
+    auto counter = Algorithms::FlatCounter::from_tokens(tokens, as_set);
+
+    uint32_t *signature =
+        signatures_.data() + i * static_cast<size_t>(permutations_);
+    compute_signature(counter, signature);
+
+    for (uint32_t band = 0; band < bands_; ++band) {
+      const uint64_t key =
+          band_bucket(signature + band * rows_per_band_, rows_per_band_);
+      buckets_[band][key].push_back(static_cast<uint32_t>(i));
+    }
+
+    documents_.push_back(std::move(counter));
+    texts_.push_back(std::move(processed));
+  }
+}
+
+void MinHashIndex::compute_signature(const Algorithms::FlatCounter &counter,
+                                     uint32_t *signature) const {
+  std::fill_n(signature, permutations_,
+              std::numeric_limits<uint32_t>::max());
+
+  for (const auto &entry : counter.entries()) {
+    for (uint32_t p = 0; p < permutations_; ++p) {
+      const auto &perm = permutation_params_[p];
+      const auto hash = static_cast<uint32_t>(
+          (perm.multiplier * entry.hash + perm.addend) >> 32);
+      signature[p] = std::min(signature[p], hash);
+    }
+  }
+}
+
+std::vector<uint32_t>
+MinHashIndex::collect_candidates(const uint32_t *signature) const {
+  std::unordered_set<uint32_t> seen;
+  for (uint32_t band = 0; band < bands_; ++band) {
+    const uint64_t key =
+        band_bucket(signature + band * rows_per_band_, rows_per_band_);
+    auto it = buckets_[band].find(key);
+    if (it == buckets_[band].end()) {
+      continue;
+    }
+    seen.insert(it->second.begin(), it->second.end());
+  }
+
+  std::vector<uint32_t> candidates(seen.begin(), seen.end());
+  std::sort(candidates.begin(), candidates.end());
+  return candidates;
+}
+
+std::unique_ptr<Core::IPreparedQuery>
+MinHashIndex::adopt_document(const Core::ISimilarityAlgorithm &algo,
+                             uint32_t document) const {
+  auto state = std::make_shared<Algorithms::FlatCounter>(documents_[document]);
+  return algo.adopt_prepared_state(texts_[document], std::move(state));
+}
+
+double MinHashIndex::estimate_similarity(size_t i, size_t j) const {
+  const uint32_t *a =
+      signatures_.data() + i * static_cast<size_t>(permutations_);
+  const uint32_t *b =
+      signatures_.data() + j * static_cast<size_t>(permutations_);
+
+  // Contiguous equality count; compilers vectorize this loop with the
+  // build's -mavx2 flags
+  uint32_t equal = 0;
+  for (uint32_t p = 0; p < permutations_; ++p) {
+    equal += (a[p] == b[p]) ? 1U : 0U;
+  }
+  return static_cast<double>(equal) / static_cast<double>(permutations_);
+}
+
+std::vector<Core::TopKMatch>
+MinHashIndex::query_near(std::string_view text, double min_similarity) const {
+  min_similarity = std::clamp(min_similarity, 0.0, 1.0);
+
+  Core::UnicodeString query_string{std::string(text)};
+  auto processed =
+      Algorithms::BaseAlgorithm::preprocess_string(query_string, config_);
+  auto tokens = Algorithms::BaseAlgorithm::tokenize_string(processed, config_);
+  const bool as_set = config_.preprocessing == Core::PreprocessingMode::Word;
+  auto query_counter = Algorithms::FlatCounter::from_tokens(tokens, as_set);
+
+  std::vector<uint32_t> query_signature(permutations_);
+  compute_signature(query_counter, query_signature.data());
+
+  auto candidates = collect_candidates(query_signature.data());
+  if (candidates.empty()) {
+    return {};
+  }
+
+  // Exact re-verification through the real algorithm: the reported
+  // similarities are true Jaccard scores, not estimates
+  auto algo =
+      factory_->create_algorithm(Core::AlgorithmType::Jaccard, config_);
+  auto prepared = algo->prepare_query(query_string);
+
+  std::vector<Core::TopKMatch> matches;
+  for (uint32_t candidate : candidates) {
+    auto document_prepared = adopt_document(*algo, candidate);
+    auto result =
+        algo->calculate_similarity_profiles(*prepared, *document_prepared);
+    if (!result.is_success() || result.value() < min_similarity) {
+      continue;
+    }
+    matches.push_back(Core::TopKMatch{candidate, result.value()});
+  }
+
+  // Best first; ties break toward the earlier document for determinism
+  std::sort(matches.begin(), matches.end(),
+            [](const Core::TopKMatch &a, const Core::TopKMatch &b) {
+              if (a.similarity != b.similarity) {
+                return a.similarity > b.similarity;
+              }
+              return a.index < b.index;
+            });
+
+  return matches;
+}
+
+std::vector<std::vector<uint32_t>>
+MinHashIndex::deduplicate(double min_similarity) const {
+  min_similarity = std::clamp(min_similarity, 0.0, 1.0);
+
+  // Candidate pairs are documents sharing at least one band bucket,
+  // deduplicated across bands before any exact scoring
+  std::unordered_set<uint64_t> pairs;
+  for (const auto &table : buckets_) {
+    for (const auto &[key, members] : table) {
+      for (size_t a = 0; a < members.size(); ++a) {
+        for (size_t b = a + 1; b < members.size(); ++b) {
+          const uint32_t lo = std::min(members[a], members[b]);
+          const uint32_t hi = std::max(members[a], members[b]);
+          pairs.insert((static_cast<uint64_t>(lo) << 32) | hi);
+        }
+      }
+    }
+  }
+
+  std::vector<uint32_t> parent(documents_.size());
+  std::iota(parent.begin(), parent.end(), 0U);
+
+  auto algo =
+      factory_->create_algorithm(Core::AlgorithmType::Jaccard, config_);
+
+  for (uint64_t pair : pairs) {
+    const auto lo = static_cast<uint32_t>(pair >> 32);
+    const auto hi = static_cast<uint32_t>(pair & 0xFFFFFFFFULL);
+
+    const uint32_t root_lo = find_root(parent, lo);
+    const uint32_t root_hi = find_root(parent, hi);
+    if (root_lo == root_hi) {
+      continue;
+    }
+
+    auto prepared_lo = adopt_document(*algo, lo);
+    auto prepared_hi = adopt_document(*algo, hi);
+    auto result =
+        algo->calculate_similarity_profiles(*prepared_lo, *prepared_hi);
+    if (!result.is_success() || result.value() < min_similarity) {
+      continue;
+    }
+
+    parent[std::max(root_lo, root_hi)] = std::min(root_lo, root_hi);
+  }
+
+  // Emit clusters of two or more, members ascending, ordered by the
+  // smallest member (which is also the cluster root)
+  std::unordered_map<uint32_t, std::vector<uint32_t>> clusters;
+  for (uint32_t i = 0; i < parent.size(); ++i) {
+    clusters[find_root(parent, i)].push_back(i);
+  }
+
+  std::vector<std::vector<uint32_t>> groups;
+  for (auto &[root, members] : clusters) {
+    if (members.size() >= 2) {
+      std::sort(members.begin(), members.end());
+      groups.push_back(std::move(members));
+    }
+  }
+  std::sort(groups.begin(), groups.end(),
+            [](const std::vector<uint32_t> &a, const std::vector<uint32_t> &b) {
+              return a.front() < b.front();
+            });
+
+  return groups;
+}
+
+} // namespace TextSimilarity::LSH
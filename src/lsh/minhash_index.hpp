@@ -0,0 +1,93 @@
+#pragma once
+
+#include "../algorithms/token_based.hpp"
+#include "../core/interfaces.hpp"
+#include "../core/types.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace TextSimilarity::LSH {
+
+// MinHash signatures with locality-sensitive hashing for approximate
+// Jaccard at corpus scale.
+//
+// Construction tokenizes every document through the shared preprocessing
+// pipeline (typically NGram mode), hashes the distinct tokens through a
+// configurable number of permutations and keeps the resulting signatures
+// in one contiguous uint32_t array (stride = permutation count), so
+// signature comparison is a branch-free equality count. The signatures are
+// split into bands and each band is hashed into a bucket table: documents
+// sharing at least one band bucket with a query are candidates, everything
+// else is never touched. Candidates are re-verified with the exact
+// JaccardAlgorithm, so returned similarities match brute-force scoring —
+// the approximation only affects recall near the threshold, never the
+// reported values.
+//
+// Defaults: 128 permutations in 32 bands of 4 rows, which targets
+// thresholds around 0.5-0.8. config.minhash_permutations and
+// config.lsh_bands override; the band count must divide the permutation
+// count.
+class MinHashIndex final {
+public:
+  MinHashIndex(const std::vector<std::string> &strings,
+               const Core::AlgorithmConfig &config);
+
+  [[nodiscard]] size_t size() const noexcept { return documents_.size(); }
+  [[nodiscard]] uint32_t permutations() const noexcept {
+    return permutations_;
+  }
+  [[nodiscard]] uint32_t bands() const noexcept { return bands_; }
+
+  // Retrieve documents whose exact Jaccard similarity with the text reaches
+  // min_similarity, restricted to LSH candidates; results are best first
+  [[nodiscard]] std::vector<Core::TopKMatch>
+  query_near(std::string_view text, double min_similarity) const;
+
+  // Group the indexed documents into duplicate clusters: documents end up
+  // in the same group when they are connected by pairs whose exact Jaccard
+  // similarity reaches min_similarity. Only groups with two or more
+  // members are returned, each sorted ascending, ordered by first member.
+  [[nodiscard]] std::vector<std::vector<uint32_t>>
+  deduplicate(double min_similarity) const;
+
+  // Fraction of equal signature slots between two indexed documents — the
+  // unbiased MinHash estimate of their Jaccard similarity
+  [[nodiscard]] double estimate_similarity(size_t i, size_t j) const;
+
+private:
+  struct Permutation {
+    uint64_t multiplier;
+    uint64_t addend;
+  };
+
+  // Signature of one already-tokenized document, written into the
+  // contiguous array at the given stride offset
+  void compute_signature(const Algorithms::FlatCounter &counter,
+                         uint32_t *signature) const;
+
+  [[nodiscard]] std::vector<uint32_t>
+  collect_candidates(const uint32_t *signature) const;
+
+  // Wrap a stored document counter as prepared state for exact scoring
+  [[nodiscard]] std::unique_ptr<Core::IPreparedQuery>
+  adopt_document(const Core::ISimilarityAlgorithm &algo,
+                 uint32_t document) const;
+
+  Core::AlgorithmConfig config_;
+  std::unique_ptr<Core::IAlgorithmFactory> factory_;
+  uint32_t permutations_;
+  uint32_t bands_;
+  uint32_t rows_per_band_;
+
+  std::vector<Permutation> permutation_params_;
+  std::vector<uint32_t> signatures_; // size() * permutations_, row-major
+  std::vector<std::unordered_map<uint64_t, std::vector<uint32_t>>> buckets_;
+  std::vector<Algorithms::FlatCounter> documents_;
+  std::vector<Core::UnicodeString> texts_; // preprocessed, for exact scoring
+};
+
+} // namespace TextSimilarity::LSH
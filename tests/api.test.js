@@ -2,6 +2,22 @@ const {
   calculateSimilarity,
   calculateDistance,
   calculateSimilarityBatch,
+  calculateOneToMany,
+  calculateOneToManyPacked,
+  calculateOneToManyAsync,
+  similarityMatrix,
+  similarityMatrixAsync,
+  findTopK,
+  findTopKAsync,
+  createSession,
+  createProfile,
+  buildIndex,
+  loadIndex,
+  createInvertedIndex,
+  createIncrementalMatcher,
+  buildSignatures,
+  deduplicate,
+  createCascade,
   calculateSimilarityAsync,
   calculateDistanceAsync,
   calculateSimilarityBatchAsync,
@@ -9,6 +25,11 @@ const {
   getGlobalConfiguration,
   getSupportedAlgorithms,
   getMemoryUsage,
+  getCacheStatistics,
+  getPrefilterStatistics,
+  getExecutorStatistics,
+  getStatistics,
+  resetStatistics,
   clearCaches,
   parseAlgorithmType,
   getAlgorithmName,
@@ -41,6 +62,17 @@ describe("text-similarity-node", () => {
       expect(result.error).toBeUndefined();
     });
 
+    test("calculateSimilarity - accepts Buffer and Uint8Array inputs", () => {
+      const fromBuffers = calculateSimilarity(
+        Buffer.from("hello", "utf8"),
+        new TextEncoder().encode("hallo"),
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(fromBuffers.success).toBe(true);
+      expect(fromBuffers.value).toBeCloseTo(0.8, 2);
+    });
+
     test("calculateSimilarity - Jaccard with n-grams", () => {
       const result = calculateSimilarity(
         "hello",
@@ -52,114 +84,1041 @@ describe("text-similarity-node", () => {
         },
       );
 
-      expect(result.success).toBe(true);
-      expect(result.value).toBeGreaterThan(0);
-      expect(result.value).toBeLessThanOrEqual(1);
+      expect(result.success).toBe(true);
+      expect(result.value).toBeGreaterThan(0);
+      expect(result.value).toBeLessThanOrEqual(1);
+    });
+
+    test("calculateSimilarity - Cosine with words", () => {
+      const result = calculateSimilarity(
+        "hello world",
+        "world hello",
+        AlgorithmType.COSINE,
+        {
+          preprocessing: PreprocessingMode.WORD,
+        },
+      );
+
+      expect(result.success).toBe(true);
+      expect(result.value).toBeCloseTo(1.0, 2); // Same words, different order
+    });
+
+    test("calculateSimilarity - Jaro-Winkler", () => {
+      const result = calculateSimilarity(
+        "martha",
+        "marhta",
+        AlgorithmType.JARO_WINKLER,
+        {
+          prefixWeight: 0.1,
+          prefixLength: 4,
+        },
+      );
+
+      expect(result.success).toBe(true);
+      expect(result.value).toBeGreaterThan(0.9);
+    });
+
+    test("calculateSimilarity - Tversky with custom weights", () => {
+      const result = calculateSimilarity(
+        "hello",
+        "hallo",
+        AlgorithmType.TVERSKY,
+        {
+          alpha: 0.5,
+          beta: 0.5,
+          preprocessing: PreprocessingMode.NGRAM,
+          ngramSize: 2,
+        },
+      );
+
+      expect(result.success).toBe(true);
+      expect(result.value).toBeGreaterThan(0);
+    });
+
+    test("calculateDistance - Levenshtein", () => {
+      const result = calculateDistance(
+        "kitten",
+        "sitting",
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(result.success).toBe(true);
+      expect(result.value).toBe(3);
+    });
+
+    test("calculateDistance - Hamming", () => {
+      const result = calculateDistance("hello", "hallo", AlgorithmType.HAMMING);
+
+      expect(result.success).toBe(true);
+      expect(result.value).toBe(1);
+    });
+  });
+
+  describe("Batch Operations", () => {
+    const testPairs = [
+      ["hello", "hallo"],
+      ["world", "word"],
+      ["test", "text"],
+      ["similar", "similarity"],
+    ];
+
+    test("calculateSimilarityBatch - synchronous", () => {
+      const results = calculateSimilarityBatch(
+        testPairs,
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(results).toHaveLength(testPairs.length);
+
+      results.forEach((result, _index) => {
+        expect(result.success).toBe(true);
+        expect(result.value).toBeGreaterThan(0);
+        expect(result.value).toBeLessThanOrEqual(1);
+      });
+    });
+
+    test("calculateSimilarityBatch - with different algorithms", () => {
+      const results = calculateSimilarityBatch(
+        testPairs,
+        AlgorithmType.JACCARD,
+        {
+          preprocessing: PreprocessingMode.NGRAM,
+          ngramSize: 3,
+        },
+      );
+
+      expect(results).toHaveLength(testPairs.length);
+      results.forEach((result) => {
+        expect(result.success).toBe(true);
+        expect(typeof result.value).toBe("number");
+      });
+    });
+
+    test("calculateSimilarityBatch - parallel execution matches sequential", () => {
+      // Large enough to take the multi-threaded path
+      const pairs = [];
+      for (let i = 0; i < 100; i++) {
+        pairs.push([`string number ${i}`, `string numbre ${i}`]);
+      }
+
+      const sequential = calculateSimilarityBatch(
+        pairs,
+        AlgorithmType.LEVENSHTEIN,
+        { concurrency: 1 },
+      );
+      const parallel = calculateSimilarityBatch(
+        pairs,
+        AlgorithmType.LEVENSHTEIN,
+        { concurrency: 4 },
+      );
+
+      expect(parallel).toHaveLength(pairs.length);
+      parallel.forEach((result, index) => {
+        expect(result.success).toBe(true);
+        expect(result.value).toBeCloseTo(sequential[index].value, 10);
+      });
+    });
+
+    test("calculateSimilarityBatch - typed-array result format", () => {
+      const objects = calculateSimilarityBatch(
+        testPairs,
+        AlgorithmType.LEVENSHTEIN,
+      );
+      const { scores, errors } = calculateSimilarityBatch(
+        testPairs,
+        AlgorithmType.LEVENSHTEIN,
+        { resultFormat: "typed-array" },
+      );
+
+      expect(scores).toBeInstanceOf(Float64Array);
+      expect(scores).toHaveLength(testPairs.length);
+      expect(errors).toHaveLength(0);
+
+      objects.forEach((result, index) => {
+        expect(scores[index]).toBeCloseTo(result.value, 10);
+      });
+    });
+
+    test("calculateSimilarityBatch - typed-array errors are sparse", () => {
+      // Tversky without alpha/beta fails per element
+      const { scores, errors } = calculateSimilarityBatch(
+        testPairs,
+        AlgorithmType.TVERSKY,
+        { preprocessing: PreprocessingMode.NGRAM, resultFormat: "typed-array" },
+      );
+
+      expect(scores).toHaveLength(testPairs.length);
+      expect(errors).toHaveLength(testPairs.length);
+      errors.forEach((entry, index) => {
+        expect(entry.index).toBe(index);
+        expect(typeof entry.message).toBe("string");
+        expect(Number.isNaN(scores[entry.index])).toBe(true);
+      });
+    });
+  });
+
+  describe("One-to-Many Operations", () => {
+    const candidates = ["hallo", "hullo", "help", "world"];
+
+    test("calculateOneToMany - matches pairwise results", () => {
+      const results = calculateOneToMany(
+        "hello",
+        candidates,
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(results).toHaveLength(candidates.length);
+
+      results.forEach((result, index) => {
+        expect(result.success).toBe(true);
+
+        const pairwise = calculateSimilarity(
+          "hello",
+          candidates[index],
+          AlgorithmType.LEVENSHTEIN,
+        );
+        expect(result.value).toBeCloseTo(pairwise.value, 10);
+      });
+    });
+
+    test("calculateOneToMany - token-based algorithm with n-grams", () => {
+      const results = calculateOneToMany("hello", candidates, AlgorithmType.JACCARD, {
+        preprocessing: PreprocessingMode.NGRAM,
+        ngramSize: 2,
+      });
+
+      expect(results).toHaveLength(candidates.length);
+
+      results.forEach((result, index) => {
+        expect(result.success).toBe(true);
+
+        const pairwise = calculateSimilarity(
+          "hello",
+          candidates[index],
+          AlgorithmType.JACCARD,
+          {
+            preprocessing: PreprocessingMode.NGRAM,
+            ngramSize: 2,
+          },
+        );
+        expect(result.value).toBeCloseTo(pairwise.value, 10);
+      });
+    });
+
+    test("calculateOneToMany - typed-array result format", () => {
+      const objects = calculateOneToMany(
+        "hello",
+        candidates,
+        AlgorithmType.LEVENSHTEIN,
+      );
+      const { scores, errors } = calculateOneToMany(
+        "hello",
+        candidates,
+        AlgorithmType.LEVENSHTEIN,
+        { resultFormat: "typed-array" },
+      );
+
+      expect(scores).toBeInstanceOf(Float64Array);
+      expect(scores).toHaveLength(candidates.length);
+      expect(errors).toHaveLength(0);
+
+      objects.forEach((result, index) => {
+        expect(scores[index]).toBeCloseTo(result.value, 10);
+      });
+    });
+
+    test("calculateOneToMany - empty candidate array", () => {
+      const results = calculateOneToMany("hello", [], AlgorithmType.LEVENSHTEIN);
+
+      expect(Array.isArray(results)).toBe(true);
+      expect(results).toHaveLength(0);
+    });
+
+    test("calculateOneToMany - Buffer inputs match string inputs", () => {
+      const bufferResults = calculateOneToMany(
+        Buffer.from("hello", "utf8"),
+        candidates.map((c) => Buffer.from(c, "utf8")),
+        AlgorithmType.LEVENSHTEIN,
+      );
+      const stringResults = calculateOneToMany(
+        "hello",
+        candidates,
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(bufferResults).toHaveLength(stringResults.length);
+      bufferResults.forEach((result, index) => {
+        expect(result.success).toBe(true);
+        expect(result.value).toBeCloseTo(stringResults[index].value, 10);
+      });
+    });
+
+    test("calculateOneToManyPacked - packed buffer matches array form", () => {
+      const encoder = new TextEncoder();
+      const parts = candidates.map((c) => encoder.encode(c));
+      const offsets = new Uint32Array(parts.length + 1);
+      parts.forEach((part, i) => (offsets[i + 1] = offsets[i] + part.length));
+      const buffer = new Uint8Array(offsets[parts.length]);
+      parts.forEach((part, i) => buffer.set(part, offsets[i]));
+
+      const packed = calculateOneToManyPacked(
+        "hello",
+        buffer,
+        offsets,
+        AlgorithmType.LEVENSHTEIN,
+      );
+      const plain = calculateOneToMany(
+        "hello",
+        candidates,
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(packed).toHaveLength(plain.length);
+      packed.forEach((result, index) => {
+        expect(result.success).toBe(true);
+        expect(result.value).toBeCloseTo(plain[index].value, 10);
+      });
+    });
+
+    test("calculateOneToManyAsync - Promise-based", async () => {
+      const results = await calculateOneToManyAsync(
+        "hello",
+        candidates,
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(Array.isArray(results)).toBe(true);
+      expect(results).toHaveLength(candidates.length);
+
+      results.forEach((similarity) => {
+        expect(typeof similarity).toBe("number");
+        expect(similarity).toBeGreaterThanOrEqual(0);
+        expect(similarity).toBeLessThanOrEqual(1);
+      });
+    });
+  });
+
+  describe("Top-K Queries", () => {
+    const candidates = ["hallo", "hullo", "help", "world", "hello"];
+
+    test("findTopK - returns best matches first", () => {
+      const matches = findTopK(
+        "hello",
+        candidates,
+        3,
+        0,
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(matches).toHaveLength(3);
+      expect(candidates[matches[0].index]).toBe("hello");
+      expect(matches[0].similarity).toBeCloseTo(1.0, 10);
+
+      for (let i = 1; i < matches.length; i++) {
+        expect(matches[i].similarity).toBeLessThanOrEqual(
+          matches[i - 1].similarity,
+        );
+      }
+    });
+
+    test("findTopK - scores match pairwise results", () => {
+      const matches = findTopK(
+        "hello",
+        candidates,
+        candidates.length,
+        0,
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      matches.forEach(({ index, similarity }) => {
+        const pairwise = calculateSimilarity(
+          "hello",
+          candidates[index],
+          AlgorithmType.LEVENSHTEIN,
+        );
+        expect(similarity).toBeCloseTo(pairwise.value, 10);
+      });
+    });
+
+    test("findTopK - minSimilarity filters weak matches", () => {
+      const matches = findTopK(
+        "hello",
+        candidates,
+        candidates.length,
+        0.7,
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(matches.length).toBeGreaterThan(0);
+      matches.forEach(({ similarity }) => {
+        expect(similarity).toBeGreaterThanOrEqual(0.7);
+      });
+    });
+
+    test("findTopK - token-based algorithm without distance pruning", () => {
+      const matches = findTopK("hello", candidates, 2, 0, AlgorithmType.JACCARD, {
+        preprocessing: PreprocessingMode.NGRAM,
+        ngramSize: 2,
+      });
+
+      expect(matches).toHaveLength(2);
+      expect(candidates[matches[0].index]).toBe("hello");
+    });
+
+    test("findTopKAsync - Promise-based", async () => {
+      const matches = await findTopKAsync(
+        "hello",
+        candidates,
+        2,
+        0,
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(matches).toHaveLength(2);
+      expect(candidates[matches[0].index]).toBe("hello");
+    });
+  });
+
+  describe("Similarity Matrix", () => {
+    const corpus = ["hello", "hallo", "help", "world"];
+
+    test("similarityMatrix - matches pairwise results", () => {
+      const n = corpus.length;
+      const matrix = similarityMatrix(corpus, AlgorithmType.LEVENSHTEIN);
+
+      expect(matrix).toBeInstanceOf(Float64Array);
+      expect(matrix).toHaveLength(n * n);
+
+      for (let i = 0; i < n; i++) {
+        expect(matrix[i * n + i]).toBe(1.0);
+
+        for (let j = 0; j < n; j++) {
+          if (i === j) continue;
+
+          const pairwise = calculateSimilarity(
+            corpus[i],
+            corpus[j],
+            AlgorithmType.LEVENSHTEIN,
+          );
+          expect(matrix[i * n + j]).toBeCloseTo(pairwise.value, 10);
+        }
+      }
+    });
+
+    test("similarityMatrix - symmetric algorithms mirror the triangle", () => {
+      const n = corpus.length;
+      const matrix = similarityMatrix(corpus, AlgorithmType.JACCARD, {
+        preprocessing: PreprocessingMode.NGRAM,
+        ngramSize: 2,
+      });
+
+      for (let i = 0; i < n; i++) {
+        for (let j = i + 1; j < n; j++) {
+          expect(matrix[i * n + j]).toBeCloseTo(matrix[j * n + i], 10);
+        }
+      }
+    });
+
+    test("similarityMatrix - empty corpus", () => {
+      const matrix = similarityMatrix([], AlgorithmType.LEVENSHTEIN);
+
+      expect(matrix).toBeInstanceOf(Float64Array);
+      expect(matrix).toHaveLength(0);
+    });
+
+    test("similarityMatrixAsync - Promise-based", async () => {
+      const n = corpus.length;
+      const matrix = await similarityMatrixAsync(
+        corpus,
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(matrix).toBeInstanceOf(Float64Array);
+      expect(matrix).toHaveLength(n * n);
+
+      for (let i = 0; i < n; i++) {
+        expect(matrix[i * n + i]).toBe(1.0);
+      }
+    });
+  });
+
+  describe("Session API", () => {
+    test("createSession - similarity matches pairwise results", () => {
+      const session = createSession(AlgorithmType.LEVENSHTEIN);
+
+      const pairs = [
+        ["hello", "hallo"],
+        ["kitten", "sitting"],
+        ["test", "test"],
+      ];
+
+      pairs.forEach(([s1, s2]) => {
+        const result = session.similarity(s1, s2);
+        expect(result.success).toBe(true);
+
+        const pairwise = calculateSimilarity(s1, s2, AlgorithmType.LEVENSHTEIN);
+        expect(result.value).toBeCloseTo(pairwise.value, 10);
+      });
+    });
+
+    test("createSession - distance matches pairwise results", () => {
+      const session = createSession(AlgorithmType.LEVENSHTEIN);
+
+      const result = session.distance("kitten", "sitting");
+      expect(result.success).toBe(true);
+      expect(result.value).toBe(3);
+    });
+
+    test("createSession - configuration applied to every call", () => {
+      const session = createSession(AlgorithmType.JACCARD, {
+        preprocessing: PreprocessingMode.NGRAM,
+        ngramSize: 3,
+      });
+
+      const result = session.similarity("hello world", "hello word");
+      expect(result.success).toBe(true);
+
+      const pairwise = calculateSimilarity(
+        "hello world",
+        "hello word",
+        AlgorithmType.JACCARD,
+        {
+          preprocessing: PreprocessingMode.NGRAM,
+          ngramSize: 3,
+        },
+      );
+      expect(result.value).toBeCloseTo(pairwise.value, 10);
+    });
+
+    test("createSession - exposes algorithm metadata", () => {
+      const session = createSession(AlgorithmType.JARO_WINKLER);
+
+      expect(session.algorithmType).toBe(AlgorithmType.JARO_WINKLER);
+      expect(typeof session.algorithmName).toBe("string");
+      expect(session.algorithmName.length).toBeGreaterThan(0);
+
+      const config = session.getConfiguration();
+      expect(typeof config).toBe("object");
+    });
+  });
+
+  describe("Profile API", () => {
+    test("createProfile - profile vs profile matches pairwise results", () => {
+      const config = { preprocessing: PreprocessingMode.NGRAM, ngramSize: 2 };
+      const p1 = createProfile("hello world", AlgorithmType.JACCARD, config);
+      const p2 = createProfile("hello word", AlgorithmType.JACCARD, config);
+
+      const result = p1.similarity(p2);
+      expect(result.success).toBe(true);
+
+      const pairwise = calculateSimilarity(
+        "hello world",
+        "hello word",
+        AlgorithmType.JACCARD,
+        config,
+      );
+      expect(result.value).toBeCloseTo(pairwise.value, 10);
+    });
+
+    test("createProfile - cosine profiles reuse cached vectors", () => {
+      const config = { preprocessing: PreprocessingMode.WORD };
+      const p1 = createProfile("the quick brown fox", AlgorithmType.COSINE, config);
+      const p2 = createProfile("the quick red fox", AlgorithmType.COSINE, config);
+
+      const result = p1.similarity(p2);
+      expect(result.success).toBe(true);
+
+      const pairwise = calculateSimilarity(
+        "the quick brown fox",
+        "the quick red fox",
+        AlgorithmType.COSINE,
+        config,
+      );
+      expect(result.value).toBeCloseTo(pairwise.value, 10);
+    });
+
+    test("createProfile - profile vs raw text", () => {
+      const profile = createProfile("hello world", AlgorithmType.SORENSEN_DICE);
+
+      const result = profile.similarity("hello word");
+      expect(result.success).toBe(true);
+
+      const pairwise = calculateSimilarity(
+        "hello world",
+        "hello word",
+        AlgorithmType.SORENSEN_DICE,
+      );
+      expect(result.value).toBeCloseTo(pairwise.value, 10);
+    });
+
+    test("createProfile - works with edit-distance algorithms", () => {
+      const p1 = createProfile("kitten", AlgorithmType.LEVENSHTEIN);
+      const p2 = createProfile("sitting", AlgorithmType.LEVENSHTEIN);
+
+      const result = p1.similarity(p2);
+      expect(result.success).toBe(true);
+
+      const pairwise = calculateSimilarity(
+        "kitten",
+        "sitting",
+        AlgorithmType.LEVENSHTEIN,
+      );
+      expect(result.value).toBeCloseTo(pairwise.value, 10);
+    });
+
+    test("createProfile - mismatched algorithms are rejected", () => {
+      const p1 = createProfile("hello", AlgorithmType.JACCARD);
+      const p2 = createProfile("hello", AlgorithmType.COSINE);
+
+      const result = p1.similarity(p2);
+      expect(result.success).toBe(false);
+    });
+
+    test("createProfile - exposes algorithm metadata", () => {
+      const profile = createProfile("hello", AlgorithmType.JACCARD);
+
+      expect(profile.algorithmType).toBe(AlgorithmType.JACCARD);
+      expect(typeof profile.algorithmName).toBe("string");
+
+      const config = profile.getConfiguration();
+      expect(typeof config).toBe("object");
+    });
+  });
+
+  describe("Corpus Index API", () => {
+    const fs = require("fs");
+    const os = require("os");
+    const path = require("path");
+
+    const corpus = ["hello world", "hello word", "goodbye world", "completely different"];
+    let indexPath;
+
+    beforeEach(() => {
+      indexPath = path.join(
+        os.tmpdir(),
+        `tsn-index-${process.pid}-${Date.now()}.tsix`,
+      );
+    });
+
+    afterEach(() => {
+      if (fs.existsSync(indexPath)) {
+        fs.unlinkSync(indexPath);
+      }
+    });
+
+    test("buildIndex/loadIndex - round trip preserves the corpus", () => {
+      const config = { preprocessing: PreprocessingMode.NGRAM, ngramSize: 2 };
+      buildIndex(corpus, indexPath, config);
+
+      const index = loadIndex(indexPath);
+      expect(index.size).toBe(corpus.length);
+
+      const stored = index.getConfiguration();
+      expect(stored.preprocessing).toBe(PreprocessingMode.NGRAM);
+      expect(stored.ngramSize).toBe(2);
+    });
+
+    test("oneToMany - token algorithm matches unindexed results", () => {
+      const config = { preprocessing: PreprocessingMode.NGRAM, ngramSize: 2 };
+      buildIndex(corpus, indexPath, config);
+      const index = loadIndex(indexPath);
+
+      const indexed = index.oneToMany("hello world", AlgorithmType.JACCARD);
+      const direct = calculateOneToMany(
+        "hello world",
+        corpus,
+        AlgorithmType.JACCARD,
+        config,
+      );
+
+      expect(indexed.length).toBe(direct.length);
+      for (let i = 0; i < indexed.length; i++) {
+        expect(indexed[i].success).toBe(true);
+        expect(indexed[i].value).toBeCloseTo(direct[i].value, 10);
+      }
+    });
+
+    test("oneToMany - edit-distance algorithm uses the stored text", () => {
+      buildIndex(corpus, indexPath, {
+        preprocessing: PreprocessingMode.CHARACTER,
+      });
+      const index = loadIndex(indexPath);
+
+      const indexed = index.oneToMany("hello world", AlgorithmType.LEVENSHTEIN);
+      const direct = calculateOneToMany(
+        "hello world",
+        corpus,
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      for (let i = 0; i < indexed.length; i++) {
+        expect(indexed[i].value).toBeCloseTo(direct[i].value, 10);
+      }
+    });
+
+    test("findTopK - returns the best matches first", () => {
+      const config = { preprocessing: PreprocessingMode.NGRAM, ngramSize: 2 };
+      buildIndex(corpus, indexPath, config);
+      const index = loadIndex(indexPath);
+
+      const matches = index.findTopK(
+        "hello world",
+        2,
+        0.1,
+        AlgorithmType.JACCARD,
+      );
+
+      expect(matches.length).toBe(2);
+      expect(matches[0].index).toBe(0);
+      expect(matches[0].similarity).toBeCloseTo(1.0, 10);
+      expect(matches[0].similarity).toBeGreaterThanOrEqual(
+        matches[1].similarity,
+      );
+    });
+
+    test("loadIndex - rejects files that are not indexes", () => {
+      fs.writeFileSync(indexPath, "definitely not an index");
+      expect(() => loadIndex(indexPath)).toThrow();
+    });
+
+    test("loadIndex - rejects missing files", () => {
+      expect(() => loadIndex(indexPath + ".missing")).toThrow();
+    });
+  });
+
+  describe("Inverted Index API", () => {
+    const corpus = ["hello world", "hello word", "goodbye world", "zzz"];
+    const config = { preprocessing: PreprocessingMode.NGRAM, ngramSize: 2 };
+
+    test("createInvertedIndex - query matches brute-force scoring", () => {
+      const index = createInvertedIndex(corpus, config);
+      expect(index.size).toBe(corpus.length);
+
+      const matches = index.query("hello world", 0.3, AlgorithmType.JACCARD);
+      const direct = calculateOneToMany(
+        "hello world",
+        corpus,
+        AlgorithmType.JACCARD,
+        config,
+      );
+
+      expect(matches.length).toBeGreaterThan(0);
+      for (const match of matches) {
+        expect(match.similarity).toBeGreaterThanOrEqual(0.3);
+        expect(match.similarity).toBeCloseTo(direct[match.index].value, 10);
+      }
+    });
+
+    test("createInvertedIndex - results are best first", () => {
+      const index = createInvertedIndex(corpus, config);
+
+      const matches = index.query("hello world", 0.1);
+      expect(matches[0].index).toBe(0);
+      expect(matches[0].similarity).toBeCloseTo(1.0, 10);
+      for (let i = 1; i < matches.length; i++) {
+        expect(matches[i - 1].similarity).toBeGreaterThanOrEqual(
+          matches[i].similarity,
+        );
+      }
+    });
+
+    test("createInvertedIndex - documents sharing no n-grams are skipped", () => {
+      const index = createInvertedIndex(corpus, config);
+
+      const matches = index.query("hello", 0.0);
+      expect(matches.some((m) => m.index === 3)).toBe(false);
+    });
+
+    test("createInvertedIndex - supports Dice verification", () => {
+      const index = createInvertedIndex(corpus, config);
+
+      const matches = index.query("hello word", 0.5, AlgorithmType.SORENSEN_DICE);
+      const direct = calculateOneToMany(
+        "hello word",
+        corpus,
+        AlgorithmType.SORENSEN_DICE,
+        config,
+      );
+
+      for (const match of matches) {
+        expect(match.similarity).toBeCloseTo(direct[match.index].value, 10);
+      }
+    });
+
+    test("createInvertedIndex - rejects unsupported verification algorithms", () => {
+      const index = createInvertedIndex(corpus, config);
+      expect(() => index.query("hello", 0.5, AlgorithmType.COSINE)).toThrow();
     });
+  });
 
-    test("calculateSimilarity - Cosine with words", () => {
-      const result = calculateSimilarity(
-        "hello world",
-        "world hello",
-        AlgorithmType.COSINE,
-        {
-          preprocessing: PreprocessingMode.WORD,
-        },
+  describe("Incremental Matcher API", () => {
+    const candidates = ["hello", "help", "helmet", "world", "hell"];
+
+    test("createIncrementalMatcher - scores match one-shot calculation", () => {
+      const matcher = createIncrementalMatcher(
+        candidates,
+        AlgorithmType.LEVENSHTEIN,
       );
+      expect(matcher.candidateCount).toBe(candidates.length);
 
-      expect(result.success).toBe(true);
-      expect(result.value).toBeCloseTo(1.0, 2); // Same words, different order
+      const matches = matcher.update("helo");
+      const direct = calculateOneToMany(
+        "helo",
+        candidates,
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(matches.length).toBeGreaterThan(0);
+      for (const match of matches) {
+        expect(match.similarity).toBeCloseTo(direct[match.index].value, 10);
+      }
+      for (let i = 1; i < matches.length; i++) {
+        expect(matches[i - 1].similarity).toBeGreaterThanOrEqual(
+          matches[i].similarity,
+        );
+      }
     });
 
-    test("calculateSimilarity - Jaro-Winkler", () => {
-      const result = calculateSimilarity(
-        "martha",
-        "marhta",
-        AlgorithmType.JARO_WINKLER,
-        {
-          prefixWeight: 0.1,
-          prefixLength: 4,
-        },
+    test("createIncrementalMatcher - keystroke sequence matches a fresh query", () => {
+      const matcher = createIncrementalMatcher(
+        candidates,
+        AlgorithmType.LEVENSHTEIN,
       );
 
-      expect(result.success).toBe(true);
-      expect(result.value).toBeGreaterThan(0.9);
+      let matches;
+      for (const query of ["h", "he", "hel", "help"]) {
+        matches = matcher.update(query);
+      }
+
+      const fresh = createIncrementalMatcher(
+        candidates,
+        AlgorithmType.LEVENSHTEIN,
+      ).update("help");
+
+      expect(matches.length).toBe(fresh.length);
+      for (let i = 0; i < matches.length; i++) {
+        expect(matches[i].index).toBe(fresh[i].index);
+        expect(matches[i].similarity).toBeCloseTo(fresh[i].similarity, 10);
+      }
     });
 
-    test("calculateSimilarity - Tversky with custom weights", () => {
-      const result = calculateSimilarity(
-        "hello",
-        "hallo",
-        AlgorithmType.TVERSKY,
-        {
-          alpha: 0.5,
-          beta: 0.5,
-          preprocessing: PreprocessingMode.NGRAM,
-          ngramSize: 2,
-        },
+    test("createIncrementalMatcher - honors k and minSimilarity", () => {
+      const matcher = createIncrementalMatcher(
+        candidates,
+        AlgorithmType.LEVENSHTEIN,
       );
 
-      expect(result.success).toBe(true);
-      expect(result.value).toBeGreaterThan(0);
+      const matches = matcher.update("hel", 2, 0.5);
+      expect(matches.length).toBeLessThanOrEqual(2);
+      for (const match of matches) {
+        expect(match.similarity).toBeGreaterThanOrEqual(0.5);
+      }
     });
 
-    test("calculateDistance - Levenshtein", () => {
-      const result = calculateDistance(
-        "kitten",
-        "sitting",
+    test("createIncrementalMatcher - reset discards retained rows", () => {
+      const matcher = createIncrementalMatcher(
+        candidates,
         AlgorithmType.LEVENSHTEIN,
       );
+      matcher.update("world");
+      matcher.reset();
 
-      expect(result.success).toBe(true);
-      expect(result.value).toBe(3);
+      const matches = matcher.update("hello");
+      expect(matches[0].index).toBe(0);
+      expect(matches[0].similarity).toBeCloseTo(1.0, 10);
     });
 
-    test("calculateDistance - Hamming", () => {
-      const result = calculateDistance("hello", "hallo", AlgorithmType.HAMMING);
+    test("createIncrementalMatcher - rejects non-edit-distance algorithms", () => {
+      expect(() =>
+        createIncrementalMatcher(candidates, AlgorithmType.JARO),
+      ).toThrow();
+    });
+  });
 
-      expect(result.success).toBe(true);
-      expect(result.value).toBe(1);
+  describe("MinHash Signature API", () => {
+    const corpus = [
+      "the quick brown fox jumps over the lazy dog",
+      "the quick brown fox jumped over the lazy dog",
+      "pack my box with five dozen liquor jugs",
+      "sphinx of black quartz judge my vow",
+    ];
+    const config = { preprocessing: PreprocessingMode.WORD };
+
+    test("buildSignatures - reports the index geometry", () => {
+      const index = buildSignatures(corpus, config);
+      expect(index.size).toBe(corpus.length);
+      expect(index.permutations).toBe(128);
+      expect(index.bands).toBe(32);
+    });
+
+    test("buildSignatures - custom geometry via configuration", () => {
+      const index = buildSignatures(corpus, {
+        ...config,
+        minhashPermutations: 64,
+        lshBands: 16,
+      });
+      expect(index.permutations).toBe(64);
+      expect(index.bands).toBe(16);
+    });
+
+    test("buildSignatures - rejects bands that do not divide permutations", () => {
+      expect(() =>
+        buildSignatures(corpus, {
+          ...config,
+          minhashPermutations: 64,
+          lshBands: 7,
+        }),
+      ).toThrow();
+    });
+
+    test("queryNear - candidates are verified with exact Jaccard", () => {
+      const index = buildSignatures(corpus, config);
+      const matches = index.queryNear(corpus[0], 0.5);
+
+      expect(matches.some((m) => m.index === 0)).toBe(true);
+      for (const match of matches) {
+        const direct = calculateSimilarity(
+          corpus[0],
+          corpus[match.index],
+          AlgorithmType.JACCARD,
+          config,
+        );
+        expect(match.similarity).toBeGreaterThanOrEqual(0.5);
+        expect(match.similarity).toBeCloseTo(direct.value, 10);
+      }
+    });
+
+    test("estimateSimilarity - identical documents estimate 1", () => {
+      const docs = [...corpus, corpus[0]];
+      const index = buildSignatures(docs, config);
+
+      expect(index.estimateSimilarity(0, docs.length - 1)).toBeCloseTo(1.0, 10);
+      expect(index.estimateSimilarity(0, 2)).toBeLessThan(0.5);
+      expect(() => index.estimateSimilarity(0, docs.length)).toThrow();
+    });
+
+    test("deduplicate - groups exact copies together", () => {
+      const docs = [...corpus, corpus[0], corpus[2]];
+      const index = buildSignatures(docs, config);
+      const groups = index.deduplicate(0.9);
+
+      const copyGroup = groups.find((group) => group.includes(0));
+      expect(copyGroup).toContain(corpus.length);
+
+      // The one-shot helper agrees with the index method
+      expect(deduplicate(docs, 0.9, config)).toEqual(groups);
     });
   });
 
-  describe("Batch Operations", () => {
-    const testPairs = [
-      ["hello", "hallo"],
-      ["world", "word"],
-      ["test", "text"],
-      ["similar", "similarity"],
+  describe("Cascade API", () => {
+    const stages = [
+      { algorithm: AlgorithmType.JARO_WINKLER, minScore: 0.8 },
+      { algorithm: AlgorithmType.LEVENSHTEIN, minScore: 0.7 },
     ];
 
-    test("calculateSimilarityBatch - synchronous", () => {
-      const results = calculateSimilarityBatch(
-        testPairs,
+    test("createCascade - outcome agrees with the individual algorithms", () => {
+      const cascade = createCascade(stages);
+      expect(cascade.stageCount).toBe(2);
+
+      const screen = calculateSimilarity(
+        "jonathan",
+        "johnathan",
+        AlgorithmType.JARO_WINKLER,
+      );
+      const confirm = calculateSimilarity(
+        "jonathan",
+        "johnathan",
         AlgorithmType.LEVENSHTEIN,
       );
+      expect(screen.value).toBeGreaterThanOrEqual(0.8);
 
-      expect(results).toHaveLength(testPairs.length);
+      const outcome = cascade.similarity("jonathan", "johnathan");
+      expect(outcome.success).toBe(true);
+      expect(outcome.stage).toBe(1);
+      expect(outcome.score).toBeCloseTo(confirm.value, 10);
+      expect(outcome.passed).toBe(confirm.value >= 0.7);
+    });
 
-      results.forEach((result, _index) => {
-        expect(result.success).toBe(true);
-        expect(result.value).toBeGreaterThan(0);
-        expect(result.value).toBeLessThanOrEqual(1);
+    test("createCascade - stops at the first failing stage", () => {
+      const cascade = createCascade(stages);
+
+      const screen = calculateSimilarity(
+        "jonathan",
+        "margaret",
+        AlgorithmType.JARO_WINKLER,
+      );
+      expect(screen.value).toBeLessThan(0.8);
+
+      const outcome = cascade.similarity("jonathan", "margaret");
+      expect(outcome.passed).toBe(false);
+      expect(outcome.stage).toBe(0);
+      expect(outcome.score).toBeCloseTo(screen.value, 10);
+    });
+
+    test("similarityBatch - agrees with the single-pair path", () => {
+      const cascade = createCascade(stages);
+      const pairs = [
+        ["jonathan", "johnathan"],
+        ["jonathan", "margaret"],
+        ["martha", "marhta"],
+      ];
+
+      const batch = cascade.similarityBatch(pairs);
+      expect(batch.length).toBe(pairs.length);
+
+      pairs.forEach((pair, i) => {
+        const single = cascade.similarity(pair[0], pair[1]);
+        expect(batch[i].passed).toBe(single.passed);
+        expect(batch[i].stage).toBe(single.stage);
+        expect(batch[i].score).toBeCloseTo(single.score, 10);
       });
     });
 
-    test("calculateSimilarityBatch - with different algorithms", () => {
-      const results = calculateSimilarityBatch(
-        testPairs,
-        AlgorithmType.JACCARD,
+    test("match - returns exactly the passing candidates, best first", () => {
+      const cascade = createCascade(stages);
+      const candidates = [
+        "johnathan",
+        "jonathon",
+        "margaret",
+        "jonathan",
+        "anthony",
+      ];
+
+      const matches = cascade.match("jonathan", candidates);
+      const passing = candidates.filter(
+        (candidate) => cascade.similarity("jonathan", candidate).passed,
+      );
+
+      expect(matches.length).toBe(passing.length);
+      expect(matches.length).toBeGreaterThan(0);
+      for (const match of matches) {
+        const single = cascade.similarity("jonathan", candidates[match.index]);
+        expect(single.passed).toBe(true);
+        expect(match.similarity).toBeCloseTo(single.score, 10);
+      }
+      for (let i = 1; i < matches.length; i++) {
+        expect(matches[i - 1].similarity).toBeGreaterThanOrEqual(
+          matches[i].similarity,
+        );
+      }
+    });
+
+    test("createCascade - per-stage configuration overrides apply", () => {
+      const cascade = createCascade([
         {
-          preprocessing: PreprocessingMode.NGRAM,
-          ngramSize: 3,
+          algorithm: AlgorithmType.LEVENSHTEIN,
+          minScore: 0.99,
+          config: { caseSensitivity: CaseSensitivity.INSENSITIVE },
         },
-      );
+      ]);
 
-      expect(results).toHaveLength(testPairs.length);
-      results.forEach((result) => {
-        expect(result.success).toBe(true);
-        expect(typeof result.value).toBe("number");
-      });
+      const outcome = cascade.similarity("HELLO", "hello");
+      expect(outcome.passed).toBe(true);
+      expect(outcome.score).toBeCloseTo(1.0, 10);
+    });
+
+    test("createCascade - rejects an empty stage list", () => {
+      expect(() => createCascade([])).toThrow();
     });
   });
 
@@ -207,6 +1166,30 @@ describe("text-similarity-node", () => {
       });
     });
 
+    test("calculateSimilarityBatchAsync - typed-array result format", async () => {
+      const testPairs = [
+        ["hello", "hallo"],
+        ["world", "word"],
+      ];
+
+      const plain = await calculateSimilarityBatchAsync(
+        testPairs,
+        AlgorithmType.LEVENSHTEIN,
+      );
+      const { scores, errors } = await calculateSimilarityBatchAsync(
+        testPairs,
+        AlgorithmType.LEVENSHTEIN,
+        { resultFormat: "typed-array" },
+      );
+
+      expect(scores).toBeInstanceOf(Float64Array);
+      expect(scores).toHaveLength(testPairs.length);
+      expect(errors).toHaveLength(0);
+      plain.forEach((similarity, index) => {
+        expect(scores[index]).toBeCloseTo(similarity, 10);
+      });
+    });
+
     test("calculateSimilarityAsync - error handling", async () => {
       // Test with very large strings that might cause memory issues
       const largeString1 = "a".repeat(1000000); // 1MB string
@@ -306,6 +1289,89 @@ describe("text-similarity-node", () => {
     });
   });
 
+  describe("Shared Result Cache", () => {
+    const cacheName = `/tsn-test-cache-${process.pid}`;
+    const cacheBytes = 1 << 20;
+
+    afterEach(() => {
+      // Detach so the remaining tests use the in-process cache again
+      setGlobalConfiguration({ sharedCache: false });
+    });
+
+    test("sharedCache - configuration round-trips", () => {
+      setGlobalConfiguration({
+        sharedCache: true,
+        sharedCacheName: cacheName,
+        sharedCacheBytes: cacheBytes,
+      });
+
+      const config = getGlobalConfiguration();
+      expect(config.sharedCache).toBe(true);
+      expect(config.sharedCacheName).toBe(cacheName);
+    });
+
+    test("sharedCache - results agree with the in-process path", () => {
+      const direct = calculateSimilarity(
+        "hello",
+        "hallo",
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      setGlobalConfiguration({
+        sharedCache: true,
+        sharedCacheName: cacheName,
+        sharedCacheBytes: cacheBytes,
+      });
+      const shared = calculateSimilarity(
+        "hello",
+        "hallo",
+        AlgorithmType.LEVENSHTEIN,
+      );
+
+      expect(shared.success).toBe(true);
+      expect(shared.value).toBeCloseTo(direct.value, 10);
+    });
+
+    test("sharedCache - repeated lookups hit the shared segment", () => {
+      setGlobalConfiguration({
+        sharedCache: true,
+        sharedCacheName: cacheName,
+        sharedCacheBytes: cacheBytes,
+      });
+      resetStatistics();
+
+      calculateSimilarity(
+        "shared-cache",
+        "shared-cash",
+        AlgorithmType.LEVENSHTEIN,
+      );
+      const before = getCacheStatistics();
+      calculateSimilarity(
+        "shared-cache",
+        "shared-cash",
+        AlgorithmType.LEVENSHTEIN,
+      );
+      const after = getCacheStatistics();
+
+      expect(after.hits).toBeGreaterThan(before.hits);
+      expect(after.entries).toBeGreaterThan(0);
+    });
+
+    test("sharedCache - memory usage includes the mapped segment", () => {
+      setGlobalConfiguration({ sharedCache: false });
+      const before = getMemoryUsage();
+
+      setGlobalConfiguration({
+        sharedCache: true,
+        sharedCacheName: cacheName,
+        sharedCacheBytes: cacheBytes,
+      });
+      const after = getMemoryUsage();
+
+      expect(after).toBeGreaterThan(before);
+    });
+  });
+
   describe("Unicode Support", () => {
     test("Unicode characters - Basic Latin Extended", () => {
       const result = calculateSimilarity(
@@ -424,6 +1490,126 @@ describe("text-similarity-node", () => {
       expect(afterClear).toBeLessThanOrEqual(beforeClear);
     });
 
+    test("getCacheStatistics - counters reflect cache activity", () => {
+      const before = getCacheStatistics();
+      expect(typeof before.hits).toBe("number");
+      expect(typeof before.misses).toBe("number");
+      expect(typeof before.evictions).toBe("number");
+      expect(before.capacity).toBeGreaterThan(0);
+
+      // First call populates the cache, second call should hit it
+      calculateSimilarity("cache-stats", "cache-stat", AlgorithmType.LEVENSHTEIN);
+      calculateSimilarity("cache-stats", "cache-stat", AlgorithmType.LEVENSHTEIN);
+
+      const after = getCacheStatistics();
+      expect(after.hits).toBeGreaterThan(before.hits);
+      expect(after.entries).toBeGreaterThan(0);
+    });
+
+    test("getPrefilterStatistics - divergent candidates are skipped", () => {
+      const before = getPrefilterStatistics();
+      expect(typeof before.considered).toBe("number");
+      expect(typeof before.skipped).toBe("number");
+
+      // The length bound alone rejects candidates this far from the query
+      const results = calculateOneToMany(
+        "hello",
+        ["hallo", "a-much-longer-candidate-string", "hi"],
+        AlgorithmType.LEVENSHTEIN,
+        { threshold: 2 },
+      );
+
+      expect(results).toHaveLength(3);
+      results.forEach((result) => {
+        expect(typeof result.value).toBe("number");
+      });
+
+      const after = getPrefilterStatistics();
+      expect(after.considered).toBeGreaterThan(before.considered);
+      expect(after.skipped).toBeGreaterThan(before.skipped);
+    });
+
+    test("Prefilter - accepted candidates keep exact scores", () => {
+      const unfiltered = calculateSimilarity(
+        "kitten",
+        "sitting",
+        AlgorithmType.LEVENSHTEIN,
+      );
+      const filtered = calculateSimilarity(
+        "kitten",
+        "sitting",
+        AlgorithmType.LEVENSHTEIN,
+        { threshold: 5 },
+      );
+
+      expect(filtered.value).toBeCloseTo(unfiltered.value, 10);
+    });
+
+    test("getExecutorStatistics - workers execute async tasks", async () => {
+      const before = getExecutorStatistics();
+      expect(before.workerCount).toBeGreaterThan(0);
+      expect(typeof before.pendingTasks).toBe("number");
+      expect(typeof before.steals).toBe("number");
+
+      await calculateSimilarityAsync("executor", "executors");
+
+      const after = getExecutorStatistics();
+      expect(after.executedTasks).toBeGreaterThan(before.executedTasks);
+    });
+
+    test("getStatistics - combined snapshot with per-algorithm histograms", () => {
+      calculateSimilarity("statistics", "statistic", AlgorithmType.JARO);
+
+      const stats = getStatistics();
+      expect(stats.cache).toBeDefined();
+      expect(stats.prefilter).toBeDefined();
+      expect(stats.executor).toBeDefined();
+      expect(stats.memory).toBeDefined();
+      expect(typeof stats.cache.hitRate).toBe("number");
+      expect(typeof stats.executor.taskWaitNs).toBe("number");
+      expect(typeof stats.memory.engineBytes).toBe("number");
+
+      const jaro = stats.algorithms["Jaro"];
+      expect(jaro).toBeDefined();
+      expect(jaro.calls).toBeGreaterThan(0);
+      expect(jaro.totalTimeNs).toBeGreaterThanOrEqual(0);
+      expect(jaro.latencyHistogramNs).toHaveLength(32);
+
+      // Every recorded call lands in exactly one bucket
+      const bucketSum = jaro.latencyHistogramNs.reduce((a, b) => a + b, 0);
+      expect(bucketSum).toBe(jaro.calls);
+    });
+
+    test("getStatistics - call counts grow with activity", () => {
+      const before = getStatistics();
+      const callsBefore = before.algorithms["Levenshtein"]
+        ? before.algorithms["Levenshtein"].calls
+        : 0;
+
+      calculateSimilarity("activity-one", "activity-two");
+      calculateSimilarity("activity-three", "activity-four");
+
+      const after = getStatistics();
+      expect(after.algorithms["Levenshtein"].calls).toBeGreaterThanOrEqual(
+        callsBefore + 2,
+      );
+    });
+
+    test("resetStatistics - zeroes cumulative counters", () => {
+      calculateSimilarity("reset-me", "reset-you");
+      expect(Object.keys(getStatistics().algorithms).length).toBeGreaterThan(0);
+
+      resetStatistics();
+
+      const stats = getStatistics();
+      expect(Object.keys(stats.algorithms)).toHaveLength(0);
+      expect(stats.cache.hits).toBe(0);
+      expect(stats.cache.misses).toBe(0);
+      expect(stats.prefilter.considered).toBe(0);
+      expect(stats.executor.executedTasks).toBe(0);
+      expect(stats.executor.taskWaitNs).toBe(0);
+    });
+
     test("Performance - Large batch processing", () => {
       const largeBatch = [];
       for (let i = 0; i < 100; i++) {
@@ -713,3 +1899,85 @@ describe("Performance Benchmarks", () => {
     expect(asyncTime).toBeLessThan(100);
   });
 });
+
+describe("CLI Streaming", () => {
+  const { spawnSync } = require("node:child_process");
+  const path = require("node:path");
+
+  const cliPath = path.resolve(__dirname, "..", "bin", "cli.js");
+
+  const runStream = (lines, args = []) => {
+    const result = spawnSync(process.execPath, [cliPath, "stream", ...args], {
+      input: lines.join("\n") + "\n",
+      encoding: "utf8",
+      timeout: 30000,
+    });
+
+    expect(result.error).toBeUndefined();
+    expect(result.status).toBe(0);
+    return result.stdout
+      .split("\n")
+      .filter((line) => line.trim() !== "")
+      .map((line) => JSON.parse(line));
+  };
+
+  test("stream - scores NDJSON records through the batch path", () => {
+    const output = runStream([
+      JSON.stringify(["hello", "hallo"]),
+      JSON.stringify({ s1: "world", s2: "word", id: "pair-2" }),
+    ]);
+
+    expect(output).toHaveLength(2);
+    expect(output[0].index).toBe(0);
+    expect(output[0].value).toBeCloseTo(
+      calculateSimilarity("hello", "hallo", AlgorithmType.LEVENSHTEIN).value,
+      10,
+    );
+    expect(output[1].id).toBe("pair-2");
+    expect(output[1].value).toBeCloseTo(
+      calculateSimilarity("world", "word", AlgorithmType.LEVENSHTEIN).value,
+      10,
+    );
+  });
+
+  test("stream - honors the algorithm flag across chunk boundaries", () => {
+    const pairs = Array.from({ length: 10 }, (_, i) => [`word${i}`, "word"]);
+    const output = runStream(
+      pairs.map((pair) => JSON.stringify(pair)),
+      ["-a", "jaro-winkler", "--chunk-size", "3"],
+    );
+
+    expect(output).toHaveLength(pairs.length);
+    output.forEach((line, i) => {
+      expect(line.index).toBe(i);
+      expect(line.value).toBeCloseTo(
+        calculateSimilarity(pairs[i][0], pairs[i][1], AlgorithmType.JARO_WINKLER)
+          .value,
+        10,
+      );
+    });
+  });
+
+  test("stream - config accepts string enum names", () => {
+    const output = runStream(
+      [JSON.stringify(["HELLO", "hello"])],
+      ["--config", '{"caseSensitivity":"insensitive"}'],
+    );
+
+    expect(output).toHaveLength(1);
+    expect(output[0].value).toBeCloseTo(1.0, 10);
+  });
+
+  test("stream - malformed records produce error lines, not a crash", () => {
+    const output = runStream([
+      JSON.stringify(["hello", "hallo"]),
+      "not json",
+      JSON.stringify({ s1: "only-one" }),
+    ]);
+
+    expect(output).toHaveLength(3);
+    expect(typeof output[0].value).toBe("number");
+    expect(output[1].error).toBeDefined();
+    expect(output[2].error).toBeDefined();
+  });
+});